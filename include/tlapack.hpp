@@ -28,7 +28,9 @@
 // Level 2 BLAS template implementations
 
 #include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/gemv2.hpp"
 #include "tlapack/blas/ger.hpp"
+#include "tlapack/blas/ger2.hpp"
 #include "tlapack/blas/geru.hpp"
 #include "tlapack/blas/hemv.hpp"
 #include "tlapack/blas/her.hpp"
@@ -80,6 +82,7 @@
 #include "tlapack/lapack/larfb.hpp"
 #include "tlapack/lapack/larfg.hpp"
 #include "tlapack/lapack/larft.hpp"
+#include "tlapack/lapack/larft_recursive.hpp"
 #include "tlapack/lapack/larnv.hpp"
 #include "tlapack/lapack/lascl.hpp"
 #include "tlapack/lapack/laset.hpp"
@@ -97,6 +100,7 @@
 // QR factorization
 // ----------------
 
+#include "tlapack/lapack/compact_wy.hpp"
 #include "tlapack/lapack/geqr2.hpp"
 #include "tlapack/lapack/ung2r.hpp"
 #include "tlapack/lapack/unm2r.hpp"
@@ -139,6 +143,22 @@
 #include "tlapack/lapack/unghr.hpp"
 #include "tlapack/lapack/unmhr.hpp"
 
+// Hermitian standard eigenvalue routines
+// ----------------
+
+#include "tlapack/lapack/heev.hpp"
+#include "tlapack/lapack/hetd2.hpp"
+#include "tlapack/lapack/hetrd.hpp"
+#include "tlapack/lapack/laed1.hpp"
+#include "tlapack/lapack/laed4.hpp"
+#include "tlapack/lapack/laev2.hpp"
+#include "tlapack/lapack/latrd.hpp"
+#include "tlapack/lapack/stebz.hpp"
+#include "tlapack/lapack/stedc.hpp"
+#include "tlapack/lapack/stein.hpp"
+#include "tlapack/lapack/steqr.hpp"
+#include "tlapack/lapack/unmtr.hpp"
+
 // LU
 // ----------------
 
@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_ASUM_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/level1_kernels.hpp"
 
 namespace tlapack {
 
@@ -19,6 +20,9 @@ namespace tlapack {
  * Vector 1-norm:
  *      $\sum_{i=0}^{n-1} |Re(x_i)| + |Im(x_i)|$.
  *
+ * The absolute values are accumulated in four partial sums, @see
+ * internal::dot4().
+ *
  * @param[in] x     A n-element vector.
  *
  * @ingroup blas1
@@ -33,11 +37,12 @@ auto asum(vector_t const& x)
     // constants
     const idx_t n = size(x);
 
-    real_t result = 0;
-    for (idx_t i = 0; i < n; ++i)
-        result += abs1(x[i]);
-
-    return result;
+    return internal::level1_apply(
+        [n](const auto& x) {
+            return internal::dot4<real_t>(
+                n, [&](idx_t i) { return real_t(abs1(x[i])); });
+        },
+        x);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_AXPY_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/level1_kernels.hpp"
 
 namespace tlapack {
 
@@ -41,8 +42,12 @@ void axpy(const alpha_t& alpha, const vectorX_t& x, vectorY_t& y)
     // check arguments
     tlapack_check_false((idx_t)size(y) < n);
 
-    for (idx_t i = 0; i < n; ++i)
-        y[i] += alpha * x[i];
+    internal::level1_apply(
+        [&](const auto& x, auto&& y) {
+            for (idx_t i = 0; i < n; ++i)
+                y[i] += alpha * x[i];
+        },
+        x, y);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
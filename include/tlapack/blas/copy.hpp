@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_COPY_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/level1_kernels.hpp"
 
 namespace tlapack {
 
@@ -38,8 +39,12 @@ void copy(const vectorX_t& x, vectorY_t& y)
     // check arguments
     tlapack_check_false((idx_t)size(y) < n);
 
-    for (idx_t i = 0; i < n; ++i)
-        y[i] = x[i];
+    internal::level1_apply(
+        [n](const auto& x, auto&& y) {
+            for (idx_t i = 0; i < n; ++i)
+                y[i] = x[i];
+        },
+        x, y);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_DOT_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/level1_kernels.hpp"
 
 namespace tlapack {
 
@@ -19,6 +20,8 @@ namespace tlapack {
  * @return dot product, $x^H y$.
  * @see dotu for unconjugated version, $x^T y$.
  *
+ * The products are accumulated in four partial sums, @see internal::dot4().
+ *
  * @param[in] x A n-element vector.
  * @param[in] y A n-element vector.
  *
@@ -40,11 +43,12 @@ auto dot(const vectorX_t& x, const vectorY_t& y)
     // check arguments
     tlapack_check_false(size(y) != n);
 
-    return_t result(0);
-    for (idx_t i = 0; i < n; ++i)
-        result += conj(x[i]) * y[i];
-
-    return result;
+    return internal::level1_apply(
+        [n](const auto& x, const auto& y) {
+            return internal::dot4<return_t>(
+                n, [&](idx_t i) { return conj(x[i]) * y[i]; });
+        },
+        x, y);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
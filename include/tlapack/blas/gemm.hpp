@@ -15,6 +15,157 @@
 
 namespace tlapack {
 
+/**
+ * Options struct for gemm()
+ *
+ * @tparam accum_t Type of the accumulators of the sums of products of the
+ *      entries of op(A) and op(B), e.g., float for Eigen::half matrices or
+ *      double for float matrices. If void, gemm() accumulates in the type
+ *      scalar_type<TA, TB>.
+ */
+template <class accum_t = void>
+struct GemmOpts {
+    size_t mb = 64;   ///< Number of rows of the blocks of op(A) and C
+    size_t nb = 64;   ///< Number of columns of the blocks of op(B) and C
+    size_t kb = 256;  ///< Number of columns of op(A) in each packed block
+};
+
+namespace internal {
+
+    /// Converts x to the type T, entry by entry if T is complex
+    template <class T, class U>
+    constexpr T gemm_cast(const U& x)
+    {
+        if constexpr (is_complex<T> && is_complex<U>)
+            return T(real_type<T>(real(x)), real_type<T>(imag(x)));
+        else if constexpr (is_complex<T>)
+            return T(real_type<T>(x));
+        else
+            return T(x);
+    }
+
+    /** General matrix-matrix multiply with accumulators of type accum_t
+     *
+     * C is computed in blocks of opts.mb-by-opts.nb entries, which are
+     * accumulated in accum_t over the full inner dimension k before they are
+     * scaled and stored in C. For each block of C, the blocks of op(A) and
+     * op(B) are packed in contiguous buffers of type accum_t, so that the
+     * entries are converted once per block and the innermost loop runs on
+     * contiguous memory.
+     *
+     * @see gemm_work(
+        Op transA, Op transB,
+        const alpha_t& alpha, const matrixA_t& A, const matrixB_t& B,
+        const beta_t& beta, matrixC_t& C, work_t& work,
+        const GemmOpts<accum_t>& opts )
+     *
+     * @param Ap, Bp, Cp Vectors of type accum_t with at least
+     *      opts.mb * opts.kb, opts.kb * opts.nb and opts.mb * opts.nb entries.
+     *
+     * @ingroup blas3
+     */
+    template <class accum_t,
+              class matrixA_t,
+              class matrixB_t,
+              class matrixC_t,
+              class alpha_t,
+              class beta_t,
+              class vectorAp_t,
+              class vectorBp_t,
+              class vectorCp_t>
+    void gemm_packed(Op transA,
+                     Op transB,
+                     const alpha_t& alpha,
+                     const matrixA_t& A,
+                     const matrixB_t& B,
+                     const beta_t& beta,
+                     matrixC_t& C,
+                     vectorAp_t& Ap,
+                     vectorBp_t& Bp,
+                     vectorCp_t& Cp,
+                     const GemmOpts<accum_t>& opts)
+    {
+        using TC = type_t<matrixC_t>;
+        using idx_t = size_type<matrixC_t>;
+
+        // constants
+        const idx_t m = nrows(C);
+        const idx_t n = ncols(C);
+        const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
+        const idx_t mb = max<idx_t>(1, opts.mb);
+        const idx_t nb = max<idx_t>(1, opts.nb);
+        const idx_t kb = max<idx_t>(1, opts.kb);
+        const accum_t alpha_ = gemm_cast<accum_t>(alpha);
+
+        // Entries of op(A) and op(B) converted to accum_t
+        auto opA = [&](idx_t i, idx_t l) {
+            if (transA == Op::NoTrans)
+                return gemm_cast<accum_t>(A(i, l));
+            else if (transA == Op::Trans)
+                return gemm_cast<accum_t>(A(l, i));
+            else
+                return gemm_cast<accum_t>(conj(A(l, i)));
+        };
+        auto opB = [&](idx_t l, idx_t j) {
+            if (transB == Op::NoTrans)
+                return gemm_cast<accum_t>(B(l, j));
+            else if (transB == Op::Trans)
+                return gemm_cast<accum_t>(B(j, l));
+            else
+                return gemm_cast<accum_t>(conj(B(j, l)));
+        };
+
+        // Ap and Bp store the packed blocks of op(A) and op(B), and Cp the
+        // accumulators of C, all by columns
+        for (idx_t j0 = 0; j0 < n; j0 += nb) {
+            const idx_t nj = min(nb, n - j0);
+            for (idx_t i0 = 0; i0 < m; i0 += mb) {
+                const idx_t mi = min(mb, m - i0);
+
+                for (idx_t i = 0; i < mi * nj; ++i)
+                    Cp[i] = accum_t(0);
+
+                for (idx_t l0 = 0; l0 < k; l0 += kb) {
+                    const idx_t kl = min(kb, k - l0);
+
+                    // Pack op(A)(i0:i0+mi, l0:l0+kl) and
+                    // op(B)(l0:l0+kl, j0:j0+nj)
+                    for (idx_t l = 0; l < kl; ++l)
+                        for (idx_t i = 0; i < mi; ++i)
+                            Ap[i + l * mi] = opA(i0 + i, l0 + l);
+                    for (idx_t j = 0; j < nj; ++j)
+                        for (idx_t l = 0; l < kl; ++l)
+                            Bp[l + j * kl] = opB(l0 + l, j0 + j);
+
+                    // Cp += Ap Bp
+                    for (idx_t j = 0; j < nj; ++j) {
+                        for (idx_t l = 0; l < kl; ++l) {
+                            const accum_t blj = Bp[l + j * kl];
+                            for (idx_t i = 0; i < mi; ++i)
+                                Cp[i + j * mi] += Ap[i + l * mi] * blj;
+                        }
+                    }
+                }
+
+                // C := alpha Cp + beta C
+                for (idx_t j = 0; j < nj; ++j) {
+                    for (idx_t i = 0; i < mi; ++i) {
+                        if constexpr (is_same_v<beta_t, StrongZero>)
+                            C(i0 + i, j0 + j) =
+                                gemm_cast<TC>(alpha_ * Cp[i + j * mi]);
+                        else
+                            C(i0 + i, j0 + j) = gemm_cast<TC>(
+                                alpha_ * Cp[i + j * mi] +
+                                gemm_cast<accum_t>(beta) *
+                                    gemm_cast<accum_t>(C(i0 + i, j0 + j)));
+                    }
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
 /**
  * General matrix-matrix multiply:
  * \[
@@ -303,6 +454,190 @@ void gemm(Op transA,
     return gemm(transA, transB, alpha, A, B, StrongZero(), C);
 }
 
+/** Worksize for gemm() with options
+ *
+ * @tparam T Type of the entries of the workspace.
+ *
+ * @param[in] transA
+ * @param[in] transB
+ * @param[in] alpha Scalar.
+ * @param[in] A $op(A)$ is an m-by-k matrix.
+ * @param[in] B $op(B)$ is an k-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in] C A m-by-n matrix.
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required. The workspace is only used
+ *      if T is accum_t.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t,
+          class accum_t>
+constexpr WorkInfo gemm_worksize(Op transA,
+                                 Op transB,
+                                 const alpha_t& alpha,
+                                 const matrixA_t& A,
+                                 const matrixB_t& B,
+                                 const beta_t& beta,
+                                 const matrixC_t& C,
+                                 const GemmOpts<accum_t>& opts)
+{
+    using idx_t = size_type<matrixA_t>;
+
+    // constants
+    const idx_t m = nrows(C);
+    const idx_t n = ncols(C);
+    const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
+    const idx_t mb = min<idx_t>(max<idx_t>(1, opts.mb), m);
+    const idx_t nb = min<idx_t>(max<idx_t>(1, opts.nb), n);
+    const idx_t kb = min<idx_t>(max<idx_t>(1, opts.kb), k);
+
+    // Packed blocks of op(A) and op(B), and accumulators of C
+    if constexpr (is_same_v<T, accum_t>)
+        return (m > 0 && n > 0) ? WorkInfo(mb * kb + kb * nb + mb * nb)
+                                : WorkInfo(0);
+    else
+        return WorkInfo(0);
+}
+
+/**
+ * General matrix-matrix multiply with a chosen accumulation type:
+ * \[
+ *     C := \alpha op(A) \times op(B) + \beta C.
+ * \]
+ *
+ * If accum_t is not void, the sums of products are accumulated in accum_t,
+ * as well as the final update alpha * sum + beta * C, which is then
+ * converted to the type of C. This allows, for instance, matrices of
+ * Eigen::half to be multiplied with float accumulators. The product is
+ * computed by blocks, @see internal::gemm_packed(). If accum_t is void,
+ * this is the same as gemm() without options. Use beta = StrongZero() for
+ * $C := \alpha op(A) \times op(B)$.
+ *
+ * @see gemm(
+    Op transA,
+    Op transB,
+    const alpha_t& alpha,
+    const matrixA_t& A,
+    const matrixB_t& B,
+    const beta_t& beta,
+    matrixC_t& C )
+ *
+ * @param work Workspace of type accum_t. Use the workspace query to
+ *      determine the size needed.
+ * @param[in] opts Options.
+ *      - @c accum_t: Type of the accumulators.
+ *      - @c opts.mb, @c opts.nb, @c opts.kb: Sizes of the blocks.
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t,
+          TLAPACK_WORKSPACE work_t,
+          class accum_t>
+void gemm_work(Op transA,
+               Op transB,
+               const alpha_t& alpha,
+               const matrixA_t& A,
+               const matrixB_t& B,
+               const beta_t& beta,
+               matrixC_t& C,
+               work_t& work,
+               const GemmOpts<accum_t>& opts)
+{
+    if constexpr (std::is_void_v<accum_t>)
+        return gemm(transA, transB, alpha, A, B, beta, C);
+    else {
+        using idx_t = size_type<matrixA_t>;
+
+        // constants
+        const idx_t m = (transA == Op::NoTrans) ? nrows(A) : ncols(A);
+        const idx_t n = (transB == Op::NoTrans) ? ncols(B) : nrows(B);
+        const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
+
+        // check arguments
+        tlapack_check_false(transA != Op::NoTrans && transA != Op::Trans &&
+                            transA != Op::ConjTrans);
+        tlapack_check_false(transB != Op::NoTrans && transB != Op::Trans &&
+                            transB != Op::ConjTrans);
+        tlapack_check_false((idx_t)nrows(C) != m);
+        tlapack_check_false((idx_t)ncols(C) != n);
+        tlapack_check_false(
+            (idx_t)((transB == Op::NoTrans) ? nrows(B) : ncols(B)) != k);
+
+        // quick return
+        if (m == 0 || n == 0) return;
+
+        const idx_t mb = min<idx_t>(max<idx_t>(1, opts.mb), m);
+        const idx_t nb = min<idx_t>(max<idx_t>(1, opts.nb), n);
+        const idx_t kb = min<idx_t>(max<idx_t>(1, opts.kb), k);
+
+        // Workspace
+        auto [Ap, work1] = reshape(work, mb * kb);
+        auto [Bp, work2] = reshape(work1, kb * nb);
+        auto [Cp, work3] = reshape(work2, mb * nb);
+
+        internal::gemm_packed(transA, transB, alpha, A, B, beta, C, Ap, Bp,
+                              Cp, opts);
+    }
+}
+
+/**
+ * General matrix-matrix multiply with a chosen accumulation type.
+ *
+ * @see gemm_work(
+    Op transA,
+    Op transB,
+    const alpha_t& alpha,
+    const matrixA_t& A,
+    const matrixB_t& B,
+    const beta_t& beta,
+    matrixC_t& C,
+    work_t& work,
+    const GemmOpts<accum_t>& opts )
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t,
+          class accum_t>
+void gemm(Op transA,
+          Op transB,
+          const alpha_t& alpha,
+          const matrixA_t& A,
+          const matrixB_t& B,
+          const beta_t& beta,
+          matrixC_t& C,
+          const GemmOpts<accum_t>& opts)
+{
+    if constexpr (std::is_void_v<accum_t>)
+        return gemm(transA, transB, alpha, A, B, beta, C);
+    else {
+        // Functor
+        Create<matrixC_t> new_matrix;
+
+        // Allocates workspace
+        WorkInfo workinfo = gemm_worksize<accum_t>(transA, transB, alpha, A,
+                                                   B, beta, C, opts);
+        std::vector<accum_t> work_;
+        auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+        return gemm_work(transA, transB, alpha, A, B, beta, C, work, opts);
+    }
+}
+
 }  // namespace tlapack
 
 #endif  //  #ifndef TLAPACK_BLAS_GEMM_HH
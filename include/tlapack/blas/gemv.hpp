@@ -12,10 +12,92 @@
 #define TLAPACK_BLAS_GEMV_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/level1_kernels.hpp"
 #include "tlapack/lapack/conjugate.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /// Number of entries of y updated together by the matrix-vector products
+    constexpr std::size_t matvec_block = 256;
+
+    /// Minimum number of entries of A for a parallel matrix-vector product
+    constexpr std::size_t matvec_parallel_min = 65536;
+
+    /// Order of the diagonal blocks in trmv() and trsv()
+    constexpr std::size_t triangular_matvec_block = 64;
+
+    /** Computes y := y + alpha op(A) x
+     *
+     * op(A) is A, conj(A), A^T or A^H according to transA and conjA. The loop
+     * order follows the layout of A: the columns of op(A) are used in axpy
+     * updates when they are contiguous, and its rows in dot products
+     * otherwise. Either way, A is read once. y is split in blocks of
+     * matvec_block entries, which stay in cache while they are updated and
+     * are distributed among threads when TLAPACK_USE_OPENMP is defined.
+     *
+     * @ingroup blas2
+     */
+    template <bool transA,
+              bool conjA,
+              class alpha_t,
+              class matrixA_t,
+              class vectorX_t,
+              class vectorY_t>
+    void gemv_kernel(const alpha_t& alpha,
+                     const matrixA_t& A,
+                     const vectorX_t& x,
+                     vectorY_t& y)
+    {
+        using TA = type_t<matrixA_t>;
+        using TX = type_t<vectorX_t>;
+        using idx_t = size_type<matrixA_t>;
+
+        const idx_t m = size(y);
+        const idx_t n = size(x);
+
+        // Entry (i,j) of op(A)
+        auto opA = [&](idx_t i, idx_t j) {
+            const TA a = transA ? A(j, i) : A(i, j);
+            if constexpr (conjA)
+                return conj(a);
+            else
+                return a;
+        };
+
+        // The columns of op(A) are contiguous in memory
+        constexpr bool axpyForm =
+            (transA == (layout<matrixA_t> == Layout::RowMajor));
+
+        const idx_t mb = matvec_block;
+        const idx_t nblocks = (m + mb - 1) / mb;
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if ( \
+    nblocks > 1 && (std::size_t)m * n >= matvec_parallel_min)
+#endif
+        for (idx_t b = 0; b < nblocks; ++b) {
+            const idx_t i0 = b * mb;
+            const idx_t i1 = min(m, i0 + mb);
+            if constexpr (axpyForm) {
+                for (idx_t j = 0; j < n; ++j) {
+                    const scalar_type<alpha_t, TX> tmp = alpha * x[j];
+                    for (idx_t i = i0; i < i1; ++i)
+                        y[i] += tmp * opA(i, j);
+                }
+            }
+            else {
+                for (idx_t i = i0; i < i1; ++i) {
+                    const auto term = [&](idx_t j) { return opA(i, j) * x[j]; };
+                    y[i] += alpha * dot4<scalar_type<TA, TX>>(n, term);
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
 /**
  * General matrix-vector multiply:
  * \[
@@ -28,6 +110,9 @@ namespace tlapack {
  *     $op(A) = conj(A)$,
  * alpha and beta are scalars, x and y are vectors, and A is a matrix.
  *
+ * A is read once, in the order of its layout. For large matrices, the entries
+ * of y are computed in parallel when TLAPACK_USE_OPENMP is defined.
+ *
  * @param[in] trans
  *     The operation to be performed:
  *     - Op::NoTrans:   $y = \alpha A   x + \beta y$,
@@ -62,8 +147,6 @@ void gemv(Op trans,
           vectorY_t& y)
 {
     // data traits
-    using TA = type_t<matrixA_t>;
-    using TX = type_t<vectorX_t>;
     using idx_t = size_type<matrixA_t>;
 
     // constants
@@ -85,44 +168,15 @@ void gemv(Op trans,
     for (idx_t i = 0; i < m; ++i)
         y[i] *= beta;
 
-    if (trans == Op::NoTrans) {
-        // form y += alpha * A * x
-        for (idx_t j = 0; j < n; ++j) {
-            const scalar_type<alpha_t, TX> tmp = alpha * x[j];
-            for (idx_t i = 0; i < m; ++i) {
-                y[i] += tmp * A(i, j);
-            }
-        }
-    }
-    else if (trans == Op::Conj) {
-        // form y += alpha * conj( A ) * x
-        for (idx_t j = 0; j < n; ++j) {
-            const scalar_type<alpha_t, TX> tmp = alpha * x[j];
-            for (idx_t i = 0; i < m; ++i) {
-                y[i] += tmp * conj(A(i, j));
-            }
-        }
-    }
-    else if (trans == Op::Trans) {
-        // form y += alpha * A^T * x
-        for (idx_t i = 0; i < m; ++i) {
-            scalar_type<TA, TX> tmp(0);
-            for (idx_t j = 0; j < n; ++j) {
-                tmp += A(j, i) * x[j];
-            }
-            y[i] += alpha * tmp;
-        }
-    }
-    else {
-        // form y += alpha * A^H * x
-        for (idx_t i = 0; i < m; ++i) {
-            scalar_type<TA, TX> tmp(0);
-            for (idx_t j = 0; j < n; ++j) {
-                tmp += conj(A(j, i)) * x[j];
-            }
-            y[i] += alpha * tmp;
-        }
-    }
+    // form y += alpha * op(A) * x
+    if (trans == Op::NoTrans)
+        internal::gemv_kernel<false, false>(alpha, A, x, y);
+    else if (trans == Op::Conj)
+        internal::gemv_kernel<false, true>(alpha, A, x, y);
+    else if (trans == Op::Trans)
+        internal::gemv_kernel<true, false>(alpha, A, x, y);
+    else
+        internal::gemv_kernel<true, true>(alpha, A, x, y);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
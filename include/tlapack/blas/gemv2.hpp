@@ -0,0 +1,200 @@
+/// @file gemv2.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_GEMV2_HH
+#define TLAPACK_BLAS_GEMV2_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemv.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /** Adds the contribution of one vector of A to y := y + alpha op(A) x
+     *
+     * The vector is the column jv of A if byCols is true, and the row jv of
+     * A otherwise. Depending on op, the vector is used either in an axpy
+     * update of y or in a dot product with x that updates y[jv].
+     *
+     * @ingroup blas2
+     */
+    template <bool byCols,
+              class alpha_t,
+              class matrixA_t,
+              class vectorX_t,
+              class vectorY_t>
+    void gemv_vector_update(Op trans,
+                            const alpha_t& alpha,
+                            const matrixA_t& A,
+                            size_type<matrixA_t> jv,
+                            const vectorX_t& x,
+                            vectorY_t& y)
+    {
+        using TA = type_t<matrixA_t>;
+        using TX = type_t<vectorX_t>;
+        using idx_t = size_type<matrixA_t>;
+
+        const bool noTrans = (trans == Op::NoTrans || trans == Op::Conj);
+        const bool conjA = (trans == Op::Conj || trans == Op::ConjTrans);
+        const idx_t len = byCols ? nrows(A) : ncols(A);
+
+        // Entry i of the vector jv
+        auto a = [&](idx_t i) -> TA { return byCols ? A(i, jv) : A(jv, i); };
+
+        if (noTrans == byCols) {
+            const scalar_type<alpha_t, TX> tmp = alpha * x[jv];
+            if (conjA)
+                for (idx_t i = 0; i < len; ++i)
+                    y[i] += tmp * conj(a(i));
+            else
+                for (idx_t i = 0; i < len; ++i)
+                    y[i] += tmp * a(i);
+        }
+        else {
+            using sum_t = scalar_type<TA, TX>;
+            const auto term = [&](idx_t i) { return a(i) * x[i]; };
+            const auto termc = [&](idx_t i) { return conj(a(i)) * x[i]; };
+            y[jv] += alpha * (conjA ? dot4<sum_t>(len, termc)
+                                    : dot4<sum_t>(len, term));
+        }
+    }
+
+}  // namespace internal
+
+/**
+ * Pair of general matrix-vector multiplies with the same matrix:
+ * \[
+ *     y_1 := \alpha op_1(A) x_1 + \beta y_1, \quad
+ *     y_2 := \alpha op_2(A) x_2 + \beta y_2,
+ * \]
+ * where $op_1(A)$ and $op_2(A)$ are each one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$,
+ *     $op(A) = A^H$, or
+ *     $op(A) = conj(A)$,
+ * alpha and beta are scalars, x1, x2, y1 and y2 are vectors, and A is a
+ * matrix.
+ *
+ * Both products are computed in one sweep over A, in the order of its
+ * layout, so that A is read from memory once instead of twice as in two
+ * calls to gemv(). A typical use is the pair $y_1 = A x_1$, $y_2 = A^H x_2$.
+ *
+ * @param[in] trans1 The operation $op_1(A)$. @see gemv()
+ * @param[in] trans2 The operation $op_2(A)$. @see gemv()
+ * @param[in] alpha Scalar.
+ * @param[in] A m-by-n matrix.
+ * @param[in] x1 Vector with ncols(op_1(A)) elements.
+ * @param[in] x2 Vector with ncols(op_2(A)) elements.
+ * @param[in] beta Scalar.
+ * @param[in,out] y1 Vector with nrows(op_1(A)) elements.
+ * @param[in,out] y2 Vector with nrows(op_2(A)) elements.
+ *      y1 and y2 must not overlap.
+ *
+ * @ingroup blas2
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_VECTOR vectorX1_t,
+          TLAPACK_VECTOR vectorX2_t,
+          TLAPACK_VECTOR vectorY1_t,
+          TLAPACK_VECTOR vectorY2_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void gemv2(Op trans1,
+           Op trans2,
+           const alpha_t& alpha,
+           const matrixA_t& A,
+           const vectorX1_t& x1,
+           const vectorX2_t& x2,
+           const beta_t& beta,
+           vectorY1_t& y1,
+           vectorY2_t& y2)
+{
+    // data traits
+    using idx_t = size_type<matrixA_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const bool noTrans1 = (trans1 == Op::NoTrans || trans1 == Op::Conj);
+    const bool noTrans2 = (trans2 == Op::NoTrans || trans2 == Op::Conj);
+    const idx_t m1 = noTrans1 ? m : n;
+    const idx_t m2 = noTrans2 ? m : n;
+
+    // check arguments
+    tlapack_check_false(trans1 != Op::NoTrans && trans1 != Op::Trans &&
+                        trans1 != Op::ConjTrans && trans1 != Op::Conj);
+    tlapack_check_false(trans2 != Op::NoTrans && trans2 != Op::Trans &&
+                        trans2 != Op::ConjTrans && trans2 != Op::Conj);
+    tlapack_check_false((idx_t)size(x1) != (noTrans1 ? n : m));
+    tlapack_check_false((idx_t)size(y1) != m1);
+    tlapack_check_false((idx_t)size(x2) != (noTrans2 ? n : m));
+    tlapack_check_false((idx_t)size(y2) != m2);
+
+    // quick return
+    if (m == 0 || n == 0) return;
+
+    // form y1 := beta*y1 and y2 := beta*y2
+    for (idx_t i = 0; i < m1; ++i)
+        y1[i] *= beta;
+    for (idx_t i = 0; i < m2; ++i)
+        y2[i] *= beta;
+
+    // form y1 += alpha * op1(A) * x1 and y2 += alpha * op2(A) * x2, using
+    // each column (or row) of A for both products while it is in cache
+    if constexpr (layout<matrixA_t> == Layout::RowMajor) {
+        for (idx_t i = 0; i < m; ++i) {
+            internal::gemv_vector_update<false>(trans1, alpha, A, i, x1, y1);
+            internal::gemv_vector_update<false>(trans2, alpha, A, i, x2, y2);
+        }
+    }
+    else {
+        for (idx_t j = 0; j < n; ++j) {
+            internal::gemv_vector_update<true>(trans1, alpha, A, j, x1, y1);
+            internal::gemv_vector_update<true>(trans2, alpha, A, j, x2, y2);
+        }
+    }
+}
+
+/**
+ * Pair of general matrix-vector multiplies with the same matrix:
+ * \[
+ *     y_1 := \alpha op_1(A) x_1, \quad
+ *     y_2 := \alpha op_2(A) x_2.
+ * \]
+ *
+ * @see gemv2(
+    Op trans1, Op trans2,
+    const alpha_t& alpha, const matrixA_t& A,
+    const vectorX1_t& x1, const vectorX2_t& x2,
+    const beta_t& beta, vectorY1_t& y1, vectorY2_t& y2 )
+ *
+ * @ingroup blas2
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_VECTOR vectorX1_t,
+          TLAPACK_VECTOR vectorX2_t,
+          TLAPACK_VECTOR vectorY1_t,
+          TLAPACK_VECTOR vectorY2_t,
+          TLAPACK_SCALAR alpha_t>
+void gemv2(Op trans1,
+           Op trans2,
+           const alpha_t& alpha,
+           const matrixA_t& A,
+           const vectorX1_t& x1,
+           const vectorX2_t& x2,
+           vectorY1_t& y1,
+           vectorY2_t& y2)
+{
+    return gemv2(trans1, trans2, alpha, A, x1, x2, StrongZero(), y1, y2);
+}
+
+}  // namespace tlapack
+
+#endif  //  #ifndef TLAPACK_BLAS_GEMV2_HH
@@ -0,0 +1,103 @@
+/// @file ger2.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_GER2_HH
+#define TLAPACK_BLAS_GER2_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemv.hpp"
+
+namespace tlapack {
+
+/**
+ * General matrix rank-2 update:
+ * \[
+ *     A := \alpha_1 x_1 y_1^H + \alpha_2 x_2 y_2^H + A,
+ * \]
+ * where alpha1 and alpha2 are scalars, x1, x2, y1 and y2 are vectors,
+ * and A is an m-by-n matrix.
+ *
+ * The two rank-1 updates are applied in one sweep over A, in the order of
+ * its layout, so that A is read and written once instead of twice as in two
+ * calls to ger(). For large matrices, the columns (or rows) of A are updated
+ * in parallel when TLAPACK_USE_OPENMP is defined.
+ *
+ * @param[in] alpha1 Scalar.
+ * @param[in] x1 A m-element vector.
+ * @param[in] y1 A n-element vector.
+ * @param[in] alpha2 Scalar.
+ * @param[in] x2 A m-element vector.
+ * @param[in] y2 A n-element vector.
+ * @param[in,out] A A m-by-n matrix.
+ *
+ * @ingroup blas2
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_VECTOR vectorX1_t,
+          TLAPACK_VECTOR vectorY1_t,
+          TLAPACK_VECTOR vectorX2_t,
+          TLAPACK_VECTOR vectorY2_t,
+          TLAPACK_SCALAR alpha1_t,
+          TLAPACK_SCALAR alpha2_t>
+void ger2(const alpha1_t& alpha1,
+          const vectorX1_t& x1,
+          const vectorY1_t& y1,
+          const alpha2_t& alpha2,
+          const vectorX2_t& x2,
+          const vectorY2_t& y2,
+          matrixA_t& A)
+{
+    // data traits
+    using idx_t = size_type<matrixA_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+
+    // check arguments
+    tlapack_check_false(size(x1) != m);
+    tlapack_check_false(size(y1) != n);
+    tlapack_check_false(size(x2) != m);
+    tlapack_check_false(size(y2) != n);
+
+    if constexpr (layout<matrixA_t> == Layout::RowMajor) {
+        using scalar1_t = scalar_type<alpha1_t, type_t<vectorX1_t> >;
+        using scalar2_t = scalar_type<alpha2_t, type_t<vectorX2_t> >;
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if ( \
+    (std::size_t)m * n >= internal::matvec_parallel_min)
+#endif
+        for (idx_t i = 0; i < m; ++i) {
+            const scalar1_t tmp1 = alpha1 * x1[i];
+            const scalar2_t tmp2 = alpha2 * x2[i];
+            for (idx_t j = 0; j < n; ++j)
+                A(i, j) += tmp1 * conj(y1[j]) + tmp2 * conj(y2[j]);
+        }
+    }
+    else {
+        using scalar1_t = scalar_type<alpha1_t, type_t<vectorY1_t> >;
+        using scalar2_t = scalar_type<alpha2_t, type_t<vectorY2_t> >;
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if ( \
+    (std::size_t)m * n >= internal::matvec_parallel_min)
+#endif
+        for (idx_t j = 0; j < n; ++j) {
+            const scalar1_t tmp1 = alpha1 * conj(y1[j]);
+            const scalar2_t tmp2 = alpha2 * conj(y2[j]);
+            for (idx_t i = 0; i < m; ++i)
+                A(i, j) += x1[i] * tmp1 + x2[i] * tmp2;
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif  //  #ifndef TLAPACK_BLAS_GER2_HH
@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_HEMV_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/symv.hpp"
 
 namespace tlapack {
 
@@ -23,6 +24,10 @@ namespace tlapack {
  * where alpha and beta are scalars, x and y are vectors,
  * and A is an n-by-n Hermitian matrix.
  *
+ * Each entry of the triangle uplo of A is read once. For large matrices,
+ * blocks of columns of A are processed in parallel when TLAPACK_USE_OPENMP
+ * is defined.
+ *
  * @param[in] uplo
  *     What part of the matrix A is referenced,
  *     the opposite triangle being assumed from symmetry.
@@ -58,8 +63,6 @@ void hemv(Uplo uplo,
           vectorY_t& y)
 {
     // data traits
-    using TA = type_t<matrixA_t>;
-    using TX = type_t<vectorX_t>;
     using idx_t = size_type<matrixA_t>;
 
     // constants
@@ -75,32 +78,8 @@ void hemv(Uplo uplo,
     for (idx_t i = 0; i < n; ++i)
         y[i] *= beta;
 
-    if (uplo == Uplo::Upper) {
-        // A is stored in upper triangle
-        // form y += alpha * A * x
-        for (idx_t j = 0; j < n; ++j) {
-            const scalar_type<alpha_t, TX> tmp1 = alpha * x[j];
-            scalar_type<TA, TX> sum(0);
-            for (idx_t i = 0; i < j; ++i) {
-                y[i] += tmp1 * A(i, j);
-                sum += conj(A(i, j)) * x[i];
-            }
-            y[j] += tmp1 * real(A(j, j)) + alpha * sum;
-        }
-    }
-    else {
-        // A is stored in lower triangle
-        // form y += alpha * A * x
-        for (idx_t j = 0; j < n; ++j) {
-            const scalar_type<alpha_t, TX> tmp1 = alpha * x[j];
-            scalar_type<TA, TX> sum(0);
-            for (idx_t i = j + 1; i < n; ++i) {
-                y[i] += tmp1 * A(i, j);
-                sum += conj(A(i, j)) * x[i];
-            }
-            y[j] += tmp1 * real(A(j, j)) + alpha * sum;
-        }
-    }
+    // form y += alpha * A * x
+    internal::symv_kernel<true>(uplo, alpha, A, x, y);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
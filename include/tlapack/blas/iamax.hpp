@@ -42,6 +42,175 @@ struct IamaxOpts : public EcOpts {
                  ///< In reference BLAS, absf(a) := |Re(a)| + |Im(a)|
 };
 
+namespace internal {
+
+    /// Number of entries of the chunks in iamax_ec() and iamax_nc()
+    constexpr std::size_t iamax_chunk = 4096;
+
+    /** Scalar search for iamax_ec() and iamax_nc() starting at x[i0]
+     *
+     * smax and index are the maximum and its position among the entries
+     * before i0, which are finite and have finite absolute values.
+     *
+     * @tparam checkNaN If true, the first NaN has priority over the first
+     *      Inf, as in iamax_ec(). Otherwise, as in iamax_nc().
+     *
+     * @ingroup blas1
+     */
+    template <bool checkNaN, class vector_t, class abs_f>
+    size_type<vector_t> iamax_scalar(const vector_t& x,
+                                     abs_f absf,
+                                     size_type<vector_t> i0,
+                                     real_type<type_t<vector_t>> smax,
+                                     size_type<vector_t> index)
+    {
+        // data traits
+        using idx_t = size_type<vector_t>;
+        using T = type_t<vector_t>;
+        using real_t = real_type<T>;
+
+        // constants
+        const real_t oneFourth(0.25);
+        const idx_t n = size(x);
+
+        bool scaledsmax = false;  // indicates whether |x_i| = Inf
+        for (idx_t i = i0; i < n; ++i) {
+            if (checkNaN && isnan(x[i])) {
+                // return when first NaN found
+                return i;
+            }
+            else if (isinf(x[i])) {
+                if constexpr (checkNaN) {
+                    // keep looking for first NaN
+                    for (idx_t k = i + 1; k < n; ++k) {
+                        if (isnan(x[k])) {
+                            // return when first NaN found
+                            return k;
+                        }
+                    }
+                }
+
+                // return the position of the first Inf
+                return i;
+            }
+            else {  // still no Inf found yet
+                if (is_real<T>) {
+                    real_t a = absf(x[i]);
+                    if (a > smax) {
+                        smax = a;
+                        index = i;
+                    }
+                }
+                else if (!scaledsmax) {  // no |x_i| = Inf  yet
+                    real_t a = absf(x[i]);
+                    if (isinf(a)) {
+                        scaledsmax = true;
+                        smax = absf(oneFourth * x[i]);
+                        index = i;
+                    }
+                    else if (a > smax) {
+                        smax = a;
+                        index = i;
+                    }
+                }
+                else {  // scaledsmax = true
+                    real_t a = absf(oneFourth * x[i]);
+                    if (a > smax) {
+                        smax = a;
+                        index = i;
+                    }
+                }
+            }
+        }
+
+        return index;
+    }
+
+    /** Chunked search for iamax_ec() and iamax_nc()
+     *
+     * x is split in chunks of iamax_chunk entries. Each chunk is first
+     * scanned without branches for its maximum absolute value and for
+     * entries that are NaN or Inf, or whose absolute value overflows. If
+     * there are none, the position of the maximum is found with a second scan
+     * of the chunk, which is still in cache. The chunks are scanned in
+     * parallel when TLAPACK_USE_OPENMP is defined, and their results are
+     * combined in order. From the first chunk with special entries on, the
+     * search continues with iamax_scalar(), so that the result is the same as
+     * that of a sequential search.
+     *
+     * @ingroup blas1
+     */
+    template <bool checkNaN, class vector_t, class abs_f>
+    size_type<vector_t> iamax_chunked(const vector_t& x, abs_f absf)
+    {
+        // data traits
+        using idx_t = size_type<vector_t>;
+        using T = type_t<vector_t>;
+        using real_t = real_type<T>;
+
+        // constants
+        const idx_t n = size(x);
+        const idx_t nb = iamax_chunk;
+        const idx_t nchunks = (n + nb - 1) / nb;
+
+        // Scans x[i0:i1]. Returns true if there are special entries.
+        // Otherwise, sets cmax and cidx to the maximum absolute value and
+        // the position of its first occurrence.
+        auto scan = [&](idx_t i0, idx_t i1, real_t& cmax, idx_t& cidx) {
+            bool special = false;
+            real_t m(-1);
+            for (idx_t i = i0; i < i1; ++i) {
+                const real_t a = absf(x[i]);
+                special |= isnan(x[i]) | isinf(x[i]) | isinf(a);
+                m = (a > m) ? a : m;
+            }
+            if (special) return true;
+
+            cmax = m;
+            cidx = i1;
+            for (idx_t i = i0; i < i1; ++i)
+                if (absf(x[i]) == m) {
+                    cidx = i;
+                    break;
+                }
+            return false;
+        };
+
+        real_t smax(-1);
+        idx_t index = -1;
+
+        if (nchunks <= 1) {
+            real_t cmax(-1);
+            idx_t cidx = -1;
+            if (scan(0, n, cmax, cidx))
+                return iamax_scalar<checkNaN>(x, absf, 0, smax, index);
+            return cidx;
+        }
+
+        std::vector<real_t> cmax(nchunks, real_t(-1));
+        std::vector<idx_t> cidx(nchunks, idx_t(-1));
+        std::vector<char> special(nchunks, 0);
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if (nchunks >= 8)
+#endif
+        for (idx_t c = 0; c < nchunks; ++c)
+            special[c] = scan(c * nb, min(n, (c + 1) * nb), cmax[c], cidx[c]);
+
+        for (idx_t c = 0; c < nchunks; ++c) {
+            if (special[c])
+                return iamax_scalar<checkNaN>(x, absf, c * nb, smax, index);
+            if (cmax[c] > smax) {
+                smax = cmax[c];
+                index = cidx[c];
+            }
+        }
+
+        return index;
+    }
+
+}  // namespace internal
+
 /**
  * @brief Return $\arg\max_{i=0}^{n-1} |x_i|$
  *
@@ -49,6 +218,9 @@ struct IamaxOpts : public EcOpts {
  * @see iamax_nc(const vector_t& x, abs_f absf) for the version that does not
  * check for NaNs.
  *
+ * The search is done in chunks, which are scanned in parallel for long
+ * vectors. @see internal::iamax_chunked()
+ *
  * @param[in] x The n-element vector x.
  *
  * @param[in] absf Absolute value function.
@@ -67,70 +239,10 @@ struct IamaxOpts : public EcOpts {
 template <TLAPACK_VECTOR vector_t, class abs_f>
 size_type<vector_t> iamax_ec(const vector_t& x, abs_f absf)
 {
-    // data traits
-    using idx_t = size_type<vector_t>;
-    using T = type_t<vector_t>;
-    using real_t = real_type<T>;
-
-    // constants
-    const real_t oneFourth(0.25);
-    const idx_t n = size(x);
-
     // quick return
-    if (n <= 0) return 0;
-
-    bool scaledsmax = false;  // indicates whether |x_i| = Inf
-    real_t smax(-1);
-    idx_t index = -1;
-    idx_t i = 0;
-    for (; i < n; ++i) {
-        if (isnan(x[i])) {
-            // return when first NaN found
-            return i;
-        }
-        else if (isinf(x[i])) {
-            // keep looking for first NaN
-            for (idx_t k = i + 1; k < n; ++k) {
-                if (isnan(x[k])) {
-                    // return when first NaN found
-                    return k;
-                }
-            }
-
-            // return the position of the first Inf
-            return i;
-        }
-        else {  // still no Inf found yet
-            if (is_real<T>) {
-                real_t a = absf(x[i]);
-                if (a > smax) {
-                    smax = a;
-                    index = i;
-                }
-            }
-            else if (!scaledsmax) {  // no |x_i| = Inf  yet
-                real_t a = absf(x[i]);
-                if (isinf(a)) {
-                    scaledsmax = true;
-                    smax = absf(oneFourth * x[i]);
-                    index = i;
-                }
-                else if (a > smax) {
-                    smax = a;
-                    index = i;
-                }
-            }
-            else {  // scaledsmax = true
-                real_t a = absf(oneFourth * x[i]);
-                if (a > smax) {
-                    smax = a;
-                    index = i;
-                }
-            }
-        }
-    }
+    if (size(x) <= 0) return 0;
 
-    return index;
+    return internal::iamax_chunked<true>(x, absf);
 }
 
 /**
@@ -140,6 +252,9 @@ size_type<vector_t> iamax_ec(const vector_t& x, abs_f absf)
  * @see iamax_ec(const vector_t& x, abs_f absf) for the version that check for
  * NaNs.
  *
+ * The search is done in chunks, which are scanned in parallel for long
+ * vectors. @see internal::iamax_chunked()
+ *
  * @param[in] x The n-element vector x.
  *
  * @param[in] absf Absolute value function.
@@ -157,57 +272,12 @@ size_type<vector_t> iamax_ec(const vector_t& x, abs_f absf)
 template <TLAPACK_VECTOR vector_t, class abs_f>
 size_type<vector_t> iamax_nc(const vector_t& x, abs_f absf)
 {
-    // data traits
     using idx_t = size_type<vector_t>;
-    using T = type_t<vector_t>;
-    using real_t = real_type<T>;
-
-    // constants
-    const real_t oneFourth(0.25);
-    const idx_t n = size(x);
 
     // quick return
-    if (n <= 0) return 0;
-
-    bool scaledsmax = false;  // indicates whether |x_i| = Inf
-    real_t smax(-1);
-    idx_t index = -1;
-    idx_t i = 0;
-    for (; i < n; ++i) {
-        if (isinf(x[i])) {
-            // return the position of the first Inf
-            return i;
-        }
-        else {  // still no Inf found yet
-            if (is_real<T>) {
-                real_t a = absf(x[i]);
-                if (a > smax) {
-                    smax = a;
-                    index = i;
-                }
-            }
-            else if (!scaledsmax) {  // no |x_i| = Inf  yet
-                real_t a = absf(x[i]);
-                if (isinf(a)) {
-                    scaledsmax = true;
-                    smax = absf(oneFourth * x[i]);
-                    index = i;
-                }
-                else if (a > smax) {
-                    smax = a;
-                    index = i;
-                }
-            }
-            else {  // scaledsmax = true
-                real_t a = absf(oneFourth * x[i]);
-                if (a > smax) {
-                    smax = a;
-                    index = i;
-                }
-            }
-        }
-    }
+    if (size(x) <= 0) return 0;
 
+    const idx_t index = internal::iamax_chunked<false>(x, absf);
     return (index != idx_t(-1)) ? index : 0;
 }
 
@@ -0,0 +1,179 @@
+/// @file level1_kernels.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_LEVEL1_KERNELS_HH
+#define TLAPACK_BLAS_LEVEL1_KERNELS_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /** Sum of n terms with four independent partial sums
+     *
+     * The partial sums break the dependency chain of the accumulation, so
+     * that the loop can be vectorized and pipelined by the compiler. The
+     * order of the operations only depends on n, so the result does not
+     * depend on the storage of the operands. If
+     * TLAPACK_SEQUENTIAL_REDUCTIONS is defined, the terms are added one after
+     * the other, in the order of the reference BLAS.
+     *
+     * @param[in] n Number of terms.
+     * @param[in] f Functor such that f(j) returns the j-th term.
+     */
+    template <class T, class idx_t, class func_t>
+    inline T dot4(idx_t n, func_t f)
+    {
+#ifdef TLAPACK_SEQUENTIAL_REDUCTIONS
+        T s(0);
+        for (idx_t j = 0; j < n; ++j)
+            s += f(j);
+        return s;
+#else
+        const idx_t n4 = n - n % 4;
+        T s0(0), s1(0), s2(0), s3(0);
+        for (idx_t j = 0; j < n4; j += 4) {
+            s0 += f(j);
+            s1 += f(j + 1);
+            s2 += f(j + 2);
+            s3 += f(j + 3);
+        }
+        for (idx_t j = n4; j < n; ++j)
+            s0 += f(j);
+        return (s0 + s1) + (s2 + s3);
+#endif
+    }
+
+    /// Vector of contiguous entries in memory
+    template <class T>
+    struct contiguous_view {
+        T* ptr;
+
+        template <class idx_t>
+        constexpr T& operator[](idx_t i) const noexcept
+        {
+            return ptr[i];
+        }
+    };
+
+    /// Vector of entries with a positive stride in memory
+    template <class T, class int_t>
+    struct strided_view {
+        T* ptr;
+        int_t inc;
+
+        template <class idx_t>
+        constexpr T& operator[](idx_t i) const noexcept
+        {
+            return ptr[i * inc];
+        }
+    };
+
+    /// True if legacy_vector() gives the pointer and stride of a vector_t
+    template <class vector_t, class = int>
+    constexpr bool has_legacy_vector = false;
+
+    template <class vector_t>
+    constexpr bool has_legacy_vector<
+        vector_t,
+        std::enable_if_t<
+            std::is_pointer_v<
+                decltype(legacy_vector(std::declval<const vector_t&>()).ptr)> &&
+                std::is_lvalue_reference_v<
+                    decltype(std::declval<const vector_t&>()[0])>,
+            int>> = true;
+
+    /** Calls f(x) with x or with a view of its memory
+     *
+     * If the entries of x are stored with a positive stride, f receives a
+     * contiguous_view or a strided_view of x. The access through raw
+     * pointers lets the compiler vectorize the loop in f, which is not
+     * possible with the operator[] of most vector types. Otherwise, f
+     * receives x.
+     *
+     * @param[in] f Functor that takes one vector.
+     * @param[in,out] x Vector.
+     *
+     * @ingroup auxiliary
+     */
+    template <class func_t, class vectorX_t>
+    auto level1_apply(func_t&& f, vectorX_t& x)
+    {
+        using vX_t = std::remove_const_t<vectorX_t>;
+
+        if constexpr (has_legacy_vector<vX_t>) {
+            const auto n = size(x);
+            const auto x_ = legacy_vector(x);
+
+            using TX = std::conditional_t<
+                std::is_const_v<vectorX_t>,
+                const std::remove_pointer_t<decltype(x_.ptr)>,
+                std::remove_pointer_t<decltype(x_.ptr)>>;
+            using incX_t = decltype(x_.inc);
+
+            if (n > 0 && x_.inc > 0 &&
+                &x[n - 1] == x_.ptr + (n - 1) * x_.inc) {
+                if (x_.inc == 1) return f(contiguous_view<TX>{x_.ptr});
+                return f(strided_view<TX, incX_t>{x_.ptr, x_.inc});
+            }
+        }
+        return f(x);
+    }
+
+    /** Calls f(x, y) with x and y or with views of their memory
+     *
+     * @see level1_apply(func_t&& f, vectorX_t& x)
+     *
+     * @param[in] f Functor that takes two vectors.
+     * @param[in,out] x Vector.
+     * @param[in,out] y Vector with at least size(x) entries.
+     *
+     * @ingroup auxiliary
+     */
+    template <class func_t, class vectorX_t, class vectorY_t>
+    auto level1_apply(func_t&& f, vectorX_t& x, vectorY_t& y)
+    {
+        using vX_t = std::remove_const_t<vectorX_t>;
+        using vY_t = std::remove_const_t<vectorY_t>;
+
+        if constexpr (has_legacy_vector<vX_t> && has_legacy_vector<vY_t>) {
+            const auto n = size(x);
+            const auto x_ = legacy_vector(x);
+            const auto y_ = legacy_vector(y);
+
+            using TX = std::conditional_t<
+                std::is_const_v<vectorX_t>,
+                const std::remove_pointer_t<decltype(x_.ptr)>,
+                std::remove_pointer_t<decltype(x_.ptr)>>;
+            using TY = std::conditional_t<
+                std::is_const_v<vectorY_t>,
+                const std::remove_pointer_t<decltype(y_.ptr)>,
+                std::remove_pointer_t<decltype(y_.ptr)>>;
+            using incX_t = decltype(x_.inc);
+            using incY_t = decltype(y_.inc);
+
+            if (n > 0 && x_.inc > 0 && y_.inc > 0 &&
+                &x[n - 1] == x_.ptr + (n - 1) * x_.inc &&
+                &y[n - 1] == y_.ptr + (n - 1) * y_.inc) {
+                if (x_.inc == 1 && y_.inc == 1)
+                    return f(contiguous_view<TX>{x_.ptr},
+                             contiguous_view<TY>{y_.ptr});
+                return f(strided_view<TX, incX_t>{x_.ptr, x_.inc},
+                         strided_view<TY, incY_t>{y_.ptr, y_.inc});
+            }
+        }
+        return f(x, y);
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  //  #ifndef TLAPACK_BLAS_LEVEL1_KERNELS_HH
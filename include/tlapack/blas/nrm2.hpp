@@ -17,6 +17,7 @@
 #define TLAPACK_BLAS_NRM2_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/level1_kernels.hpp"
 #include "tlapack/lapack/lassq.hpp"
 
 namespace tlapack {
@@ -25,6 +26,13 @@ namespace tlapack {
  * @return 2-norm of vector,
  *     $|| x ||_2 := (\sum_{i=0}^{n-1} |x_i|^2)^{1/2}$.
  *
+ * The norm is computed in two phases. First, the squares are summed without
+ * scaling, in four partial sums, @see internal::dot4(). This sum is accurate
+ * if it is finite and if it is large enough that the squares that underflow
+ * do not change it. Otherwise, the sum of squares is computed again by
+ * lassq(), which scales the entries with Blue's algorithm. NaNs and Infs
+ * always take the second phase.
+ *
  * @param[in] x A n-element vector.
  *
  * @ingroup blas1
@@ -32,14 +40,39 @@ namespace tlapack {
 template <TLAPACK_VECTOR vector_t, disable_if_allow_optblas_t<vector_t> = 0>
 auto nrm2(const vector_t& x)
 {
-    using real_t = real_type<type_t<vector_t> >;
+    using T = type_t<vector_t>;
+    using idx_t = size_type<vector_t>;
+    using real_t = real_type<T>;
+
+    // constants
+    const idx_t n = size(x);
+    const real_t tsml = blue_min<real_t>();
+    const real_t eps = ulp<real_t>();
+
+    // Unscaled sum of squares
+    const real_t sumsq = internal::level1_apply(
+        [n](const auto& x) {
+            return internal::dot4<real_t>(n, [&](idx_t i) {
+                if constexpr (is_complex<T>)
+                    return real_t(real(x[i]) * real(x[i]) +
+                                  imag(x[i]) * imag(x[i]));
+                else
+                    return real_t(x[i] * x[i]);
+            });
+        },
+        x);
+
+    // Each square smaller than tsml^2 has an absolute error of at most
+    // tsml^2, so that the n of them change sumsq by at most eps sumsq
+    if (sumsq >= real_t(n) * ((tsml * tsml) / eps) && !isinf(sumsq))
+        return real_t(sqrt(sumsq));
 
     // scaled sum of squares
     real_t scl(1);
-    real_t sumsq(0);
-    lassq(x, scl, sumsq);
+    real_t ssq(0);
+    lassq(x, scl, ssq);
 
-    return real_t(scl * sqrt(sumsq));
+    return real_t(scl * sqrt(ssq));
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_ROT_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/level1_kernels.hpp"
 
 namespace tlapack {
 
@@ -56,11 +57,15 @@ void rot(vectorX_t& x, vectorY_t& y, const c_type& c, const s_type& s)
     // quick return
     if (n == 0 || (c == c_type(1) && s == s_type(0))) return;
 
-    for (idx_t i = 0; i < n; ++i) {
-        const scalar_t stmp = c * x[i] + s * y[i];
-        y[i] = c * y[i] - conj(s) * x[i];
-        x[i] = stmp;
-    }
+    internal::level1_apply(
+        [&](auto&& x, auto&& y) {
+            for (idx_t i = 0; i < n; ++i) {
+                const scalar_t stmp = c * x[i] + s * y[i];
+                y[i] = c * y[i] - conj(s) * x[i];
+                x[i] = stmp;
+            }
+        },
+        x, y);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
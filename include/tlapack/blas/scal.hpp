@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_SCAL_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/level1_kernels.hpp"
 
 namespace tlapack {
 
@@ -34,8 +35,12 @@ void scal(const alpha_t& alpha, vector_t& x)
     // constants
     const idx_t n = size(x);
 
-    for (idx_t i = 0; i < n; ++i)
-        x[i] *= alpha;
+    internal::level1_apply(
+        [&](auto&& x) {
+            for (idx_t i = 0; i < n; ++i)
+                x[i] *= alpha;
+        },
+        x);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_SWAP_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/level1_kernels.hpp"
 
 namespace tlapack {
 
@@ -39,11 +40,15 @@ void swap(vectorX_t& x, vectorY_t& y)
     // check arguments
     tlapack_check_false(size(y) != n);
 
-    for (idx_t i = 0; i < n; ++i) {
-        const TX aux = x[i];
-        x[i] = y[i];
-        y[i] = aux;
-    }
+    internal::level1_apply(
+        [n](auto&& x, auto&& y) {
+            for (idx_t i = 0; i < n; ++i) {
+                const TX aux = x[i];
+                x[i] = y[i];
+                y[i] = aux;
+            }
+        },
+        x, y);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
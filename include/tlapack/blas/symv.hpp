@@ -12,9 +12,149 @@
 #define TLAPACK_BLAS_SYMV_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemv.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /// Number of columns of A in each block of the symmetric and Hermitian
+    /// matrix-vector products
+    constexpr std::size_t symv_colblock = 64;
+
+    /// Maximum number of partial results of the parallel symmetric and
+    /// Hermitian matrix-vector products
+    constexpr std::size_t symv_nparts = 16;
+
+    /** Computes y := y + alpha A x, where A is symmetric or Hermitian
+     *
+     * Only the triangle uplo of A is read, and each of its entries is read
+     * once: column j of the triangle is used both in an axpy update of y and
+     * in a dot product with x, in the same loop. The columns are processed
+     * in blocks of symv_colblock, and each block in tiles of matvec_block
+     * rows, so that the pieces of x and y used by a tile stay in cache. The
+     * dot products use four partial sums.
+     *
+     * When TLAPACK_USE_OPENMP is defined and A is large, the column blocks
+     * are distributed cyclically among at most symv_nparts parts, processed
+     * in parallel. Each part accumulates into its own copy of y, and the
+     * copies are added to y in a fixed order.
+     *
+     * @tparam herm If true, A is Hermitian. Otherwise, A is symmetric.
+     *
+     * @ingroup blas2
+     */
+    template <bool herm,
+              class alpha_t,
+              class matrixA_t,
+              class vectorX_t,
+              class vectorY_t>
+    void symv_kernel(Uplo uplo,
+                     const alpha_t& alpha,
+                     const matrixA_t& A,
+                     const vectorX_t& x,
+                     vectorY_t& y)
+    {
+        using TA = type_t<matrixA_t>;
+        using TX = type_t<vectorX_t>;
+        using idx_t = size_type<matrixA_t>;
+        using sum_t = scalar_type<TA, TX>;
+
+        const idx_t n = size(y);
+        const idx_t nb = symv_colblock;
+        const idx_t mb = matvec_block;
+        const idx_t nblocks = (n + nb - 1) / nb;
+        const bool lower = (uplo == Uplo::Lower);
+
+        // Entry (j,i) of A for an entry (i,j) in the triangle uplo
+        auto opA = [&](idx_t i, idx_t j) {
+            if constexpr (herm)
+                return conj(A(i, j));
+            else
+                return A(i, j);
+        };
+
+        // Adds alpha times the contributions of the columns j0:j1 of the
+        // triangle uplo to w, where w(i) is the accumulator of y[i]
+        auto columnBlock = [&](idx_t j0, idx_t j1, auto&& w) {
+            sum_t sums[symv_colblock];
+            for (idx_t j = j0; j < j1; ++j)
+                sums[j - j0] = sum_t(0);
+
+            // Rows of the off-diagonal entries in the block
+            const idx_t r0 = lower ? j0 + 1 : 0;
+            const idx_t r1 = lower ? n : j1 - 1;
+
+            for (idx_t i0 = r0; i0 < r1; i0 += mb) {
+                const idx_t i1 = min(r1, i0 + mb);
+                for (idx_t j = j0; j < j1; ++j) {
+                    const idx_t ib = lower ? max(i0, j + 1) : i0;
+                    const idx_t ie = lower ? i1 : min(i1, j);
+                    if (ib >= ie) continue;
+
+                    const scalar_type<alpha_t, TX> tmp1 = alpha * x[j];
+                    sum_t s0(0), s1(0), s2(0), s3(0);
+                    idx_t i = ib;
+                    for (; i + 4 <= ie; i += 4) {
+                        w(i) += tmp1 * A(i, j);
+                        w(i + 1) += tmp1 * A(i + 1, j);
+                        w(i + 2) += tmp1 * A(i + 2, j);
+                        w(i + 3) += tmp1 * A(i + 3, j);
+                        s0 += opA(i, j) * x[i];
+                        s1 += opA(i + 1, j) * x[i + 1];
+                        s2 += opA(i + 2, j) * x[i + 2];
+                        s3 += opA(i + 3, j) * x[i + 3];
+                    }
+                    for (; i < ie; ++i) {
+                        w(i) += tmp1 * A(i, j);
+                        s0 += opA(i, j) * x[i];
+                    }
+                    sums[j - j0] += (s0 + s1) + (s2 + s3);
+                }
+            }
+
+            for (idx_t j = j0; j < j1; ++j) {
+                const scalar_type<alpha_t, TX> tmp1 = alpha * x[j];
+                if constexpr (herm)
+                    w(j) += tmp1 * real(A(j, j)) + alpha * sums[j - j0];
+                else
+                    w(j) += tmp1 * A(j, j) + alpha * sums[j - j0];
+            }
+        };
+
+#ifdef TLAPACK_USE_OPENMP
+        if (nblocks > 1 && (std::size_t)n * n >= 2 * matvec_parallel_min) {
+            using T = type_t<vectorY_t>;
+            const idx_t nparts = min<idx_t>(nblocks, symv_nparts);
+            std::vector<T> partial(nparts * n, T(0));
+
+#pragma omp parallel for schedule(static, 1)
+            for (idx_t p = 0; p < nparts; ++p) {
+                T* wp = &partial[p * n];
+                for (idx_t b = p; b < nblocks; b += nparts)
+                    columnBlock(b * nb, min(n, (b + 1) * nb),
+                                [wp](idx_t i) -> T& { return wp[i]; });
+            }
+
+            // Combine the partial results in a fixed order
+#pragma omp parallel for schedule(static)
+            for (idx_t i = 0; i < n; ++i) {
+                T sum = partial[i];
+                for (idx_t p = 1; p < nparts; ++p)
+                    sum += partial[p * n + i];
+                y[i] += sum;
+            }
+            return;
+        }
+#endif
+
+        for (idx_t b = 0; b < nblocks; ++b)
+            columnBlock(b * nb, min(n, (b + 1) * nb),
+                        [&y](idx_t i) -> decltype(auto) { return y[i]; });
+    }
+
+}  // namespace internal
+
 /**
  * Symmetric matrix-vector multiply:
  * \[
@@ -23,6 +163,10 @@ namespace tlapack {
  * where alpha and beta are scalars, x and y are vectors,
  * and A is an n-by-n symmetric matrix.
  *
+ * Each entry of the triangle uplo of A is read once. For large matrices,
+ * blocks of columns of A are processed in parallel when TLAPACK_USE_OPENMP
+ * is defined.
+ *
  * @param[in] uplo
  *     What part of the matrix A is referenced,
  *     the opposite triangle being assumed from symmetry.
@@ -55,8 +199,6 @@ void symv(Uplo uplo,
           vectorY_t& y)
 {
     // data traits
-    using TA = type_t<matrixA_t>;
-    using TX = type_t<vectorX_t>;
     using idx_t = size_type<matrixA_t>;
 
     // constants
@@ -72,32 +214,8 @@ void symv(Uplo uplo,
     for (idx_t i = 0; i < n; ++i)
         y[i] *= beta;
 
-    if (uplo == Uplo::Upper) {
-        // A is stored in upper triangle
-        // form y += alpha * A * x
-        for (idx_t j = 0; j < n; ++j) {
-            const scalar_type<alpha_t, TX> tmp1 = alpha * x[j];
-            scalar_type<TA, TX> sum(0);
-            for (idx_t i = 0; i < j; ++i) {
-                y[i] += tmp1 * A(i, j);
-                sum += A(i, j) * x[i];
-            }
-            y[j] += tmp1 * A(j, j) + alpha * sum;
-        }
-    }
-    else {
-        // A is stored in lower triangle
-        // form y += alpha * A * x
-        for (idx_t j = 0; j < n; ++j) {
-            const scalar_type<alpha_t, TX> tmp1 = alpha * x[j];
-            scalar_type<TA, TX> sum(0);
-            for (idx_t i = j + 1; i < n; ++i) {
-                y[i] += tmp1 * A(i, j);
-                sum += A(i, j) * x[i];
-            }
-            y[j] += tmp1 * A(j, j) + alpha * sum;
-        }
-    }
+    // form y += alpha * A * x
+    internal::symv_kernel<false>(uplo, alpha, A, x, y);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
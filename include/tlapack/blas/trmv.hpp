@@ -12,10 +12,128 @@
 #define TLAPACK_BLAS_TRMV_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemv.hpp"
 #include "tlapack/lapack/conjugate.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /// Computes x := op(A) x without blocking. @see trmv()
+    template <class matrixA_t, class vectorX_t>
+    void trmv_unblocked(
+        Uplo uplo, Op trans, Diag diag, const matrixA_t& A, vectorX_t& x)
+    {
+        // data traits
+        using TA = type_t<matrixA_t>;
+        using TX = type_t<vectorX_t>;
+        using idx_t = size_type<matrixA_t>;
+
+        // constants
+        const idx_t n = nrows(A);
+        const bool nonunit = (diag == Diag::NonUnit);
+
+        if (trans == Op::NoTrans) {
+            // Form x := A*x
+            if (uplo == Uplo::Upper) {
+                // upper
+                for (idx_t j = 0; j < n; ++j) {
+                    // note: NOT skipping if x[j] is zero, for consistent NAN
+                    // handling
+                    for (idx_t i = 0; i < j; ++i)
+                        x[i] += x[j] * A(i, j);
+                    if (nonunit) x[j] *= A(j, j);
+                }
+            }
+            else {
+                // lower
+                for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                    // note: NOT skipping if x[j] is zero ...
+                    for (idx_t i = n - 1; i >= j + 1; --i)
+                        x[i] += x[j] * A(i, j);
+                    if (nonunit) x[j] *= A(j, j);
+                }
+            }
+        }
+        else if (trans == Op::Conj) {
+            // Form x := A*x
+            if (uplo == Uplo::Upper) {
+                // upper
+                for (idx_t j = 0; j < n; ++j) {
+                    // note: NOT skipping if x[j] is zero, for consistent NAN
+                    // handling
+                    for (idx_t i = 0; i < j; ++i)
+                        x[i] += x[j] * conj(A(i, j));
+                    if (nonunit) x[j] *= conj(A(j, j));
+                }
+            }
+            else {
+                // lower
+                for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                    // note: NOT skipping if x[j] is zero ...
+                    for (idx_t i = n - 1; i >= j + 1; --i)
+                        x[i] += x[j] * conj(A(i, j));
+                    if (nonunit) x[j] *= conj(A(j, j));
+                }
+            }
+        }
+        else if (trans == Op::Trans) {
+            // Form  x := A^T * x
+
+            using scalar_t = scalar_type<TA, TX>;
+
+            if (uplo == Uplo::Upper) {
+                // upper
+                for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                    scalar_t tmp = x[j];
+                    if (nonunit) tmp *= A(j, j);
+                    for (idx_t i = j - 1; i != idx_t(-1); --i)
+                        tmp += A(i, j) * x[i];
+                    x[j] = tmp;
+                }
+            }
+            else {
+                // lower
+                for (idx_t j = 0; j < n; ++j) {
+                    scalar_t tmp = x[j];
+                    if (nonunit) tmp *= A(j, j);
+                    for (idx_t i = j + 1; i < n; ++i)
+                        tmp += A(i, j) * x[i];
+                    x[j] = tmp;
+                }
+            }
+        }
+        else {
+            // Form x := A^H * x
+            // same code as above A^T * x case, except add conj()
+
+            using scalar_t = scalar_type<TA, TX>;
+
+            if (uplo == Uplo::Upper) {
+                // upper
+                for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                    scalar_t tmp = x[j];
+                    if (nonunit) tmp *= conj(A(j, j));
+                    for (idx_t i = j - 1; i != idx_t(-1); --i)
+                        tmp += conj(A(i, j)) * x[i];
+                    x[j] = tmp;
+                }
+            }
+            else {
+                // lower
+                for (idx_t j = 0; j < n; ++j) {
+                    scalar_t tmp = x[j];
+                    if (nonunit) tmp *= conj(A(j, j));
+                    for (idx_t i = j + 1; i < n; ++i)
+                        tmp += conj(A(i, j)) * x[i];
+                    x[j] = tmp;
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
 /**
  * Triangular matrix-vector multiply:
  * \[
@@ -29,6 +147,11 @@ namespace tlapack {
  * x is a vector,
  * and A is an n-by-n, unit or non-unit, upper or lower triangular matrix.
  *
+ * A is processed in diagonal blocks of order 64. Each block of x is
+ * multiplied by its diagonal block without blocking and updated with the
+ * off-diagonal blocks in one call to gemv(), which is parallel for large
+ * matrices when TLAPACK_USE_OPENMP is defined.
+ *
  * @param[in] uplo
  *     What part of the matrix A is referenced,
  *     the opposite triangle being assumed to be zero.
@@ -61,12 +184,14 @@ void trmv(Uplo uplo, Op trans, Diag diag, const matrixA_t& A, vectorX_t& x)
 {
     // data traits
     using TA = type_t<matrixA_t>;
-    using TX = type_t<vectorX_t>;
     using idx_t = size_type<matrixA_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<TA>;
 
     // constants
+    const real_t one(1);
     const idx_t n = nrows(A);
-    const bool nonunit = (diag == Diag::NonUnit);
+    const idx_t nb = internal::triangular_matvec_block;
 
     // check arguments
     tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
@@ -76,101 +201,54 @@ void trmv(Uplo uplo, Op trans, Diag diag, const matrixA_t& A, vectorX_t& x)
     tlapack_check_false(nrows(A) != ncols(A));
     tlapack_check_false((idx_t)size(x) != n);
 
-    if (trans == Op::NoTrans) {
-        // Form x := A*x
-        if (uplo == Uplo::Upper) {
-            // upper
-            for (idx_t j = 0; j < n; ++j) {
-                // note: NOT skipping if x[j] is zero, for consistent NAN
-                // handling
-                for (idx_t i = 0; i < j; ++i)
-                    x[i] += x[j] * A(i, j);
-                if (nonunit) x[j] *= A(j, j);
-            }
-        }
-        else {
-            // lower
-            for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                // note: NOT skipping if x[j] is zero ...
-                for (idx_t i = n - 1; i >= j + 1; --i)
-                    x[i] += x[j] * A(i, j);
-                if (nonunit) x[j] *= A(j, j);
-            }
-        }
-    }
-    else if (trans == Op::Conj) {
-        // Form x := A*x
-        if (uplo == Uplo::Upper) {
-            // upper
-            for (idx_t j = 0; j < n; ++j) {
-                // note: NOT skipping if x[j] is zero, for consistent NAN
-                // handling
-                for (idx_t i = 0; i < j; ++i)
-                    x[i] += x[j] * conj(A(i, j));
-                if (nonunit) x[j] *= conj(A(j, j));
-            }
-        }
-        else {
-            // lower
-            for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                // note: NOT skipping if x[j] is zero ...
-                for (idx_t i = n - 1; i >= j + 1; --i)
-                    x[i] += x[j] * conj(A(i, j));
-                if (nonunit) x[j] *= conj(A(j, j));
-            }
-        }
-    }
-    else if (trans == Op::Trans) {
-        // Form  x := A^T * x
-
-        using scalar_t = scalar_type<TA, TX>;
-
-        if (uplo == Uplo::Upper) {
-            // upper
-            for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                scalar_t tmp = x[j];
-                if (nonunit) tmp *= A(j, j);
-                for (idx_t i = j - 1; i != idx_t(-1); --i)
-                    tmp += A(i, j) * x[i];
-                x[j] = tmp;
-            }
-        }
-        else {
-            // lower
-            for (idx_t j = 0; j < n; ++j) {
-                scalar_t tmp = x[j];
-                if (nonunit) tmp *= A(j, j);
-                for (idx_t i = j + 1; i < n; ++i)
-                    tmp += A(i, j) * x[i];
-                x[j] = tmp;
+    // Small matrices
+    if (n <= nb) return internal::trmv_unblocked(uplo, trans, diag, A, x);
+
+    // Entries of x are overwritten from the top if op(A) is upper triangular
+    const bool forward = ((uplo == Uplo::Upper) ==
+                          (trans == Op::NoTrans || trans == Op::Conj));
+
+    if (forward) {
+        for (idx_t j0 = 0; j0 < n; j0 += nb) {
+            const idx_t j1 = min(n, j0 + nb);
+            auto x1 = slice(x, range{j0, j1});
+
+            // x1 := op(A11) x1
+            internal::trmv_unblocked(
+                uplo, trans, diag, slice(A, range{j0, j1}, range{j0, j1}), x1);
+
+            // x1 := x1 + op(A12) x2
+            if (j1 < n) {
+                const auto x2 = slice(x, range{j1, n});
+                if (uplo == Uplo::Upper)
+                    gemv(trans, one, slice(A, range{j0, j1}, range{j1, n}),
+                         x2, one, x1);
+                else
+                    gemv(trans, one, slice(A, range{j1, n}, range{j0, j1}),
+                         x2, one, x1);
             }
         }
     }
     else {
-        // Form x := A^H * x
-        // same code as above A^T * x case, except add conj()
-
-        using scalar_t = scalar_type<TA, TX>;
-
-        if (uplo == Uplo::Upper) {
-            // upper
-            for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                scalar_t tmp = x[j];
-                if (nonunit) tmp *= conj(A(j, j));
-                for (idx_t i = j - 1; i != idx_t(-1); --i)
-                    tmp += conj(A(i, j)) * x[i];
-                x[j] = tmp;
-            }
-        }
-        else {
-            // lower
-            for (idx_t j = 0; j < n; ++j) {
-                scalar_t tmp = x[j];
-                if (nonunit) tmp *= conj(A(j, j));
-                for (idx_t i = j + 1; i < n; ++i)
-                    tmp += conj(A(i, j)) * x[i];
-                x[j] = tmp;
+        for (idx_t j1 = n; j1 > 0;) {
+            const idx_t j0 = (j1 > nb) ? j1 - nb : 0;
+            auto x1 = slice(x, range{j0, j1});
+
+            // x1 := op(A11) x1
+            internal::trmv_unblocked(
+                uplo, trans, diag, slice(A, range{j0, j1}, range{j0, j1}), x1);
+
+            // x1 := x1 + op(A10) x0
+            if (j0 > 0) {
+                const auto x0 = slice(x, range{0, j0});
+                if (uplo == Uplo::Lower)
+                    gemv(trans, one, slice(A, range{j0, j1}, range{0, j0}),
+                         x0, one, x1);
+                else
+                    gemv(trans, one, slice(A, range{0, j0}, range{j0, j1}),
+                         x0, one, x1);
             }
+            j1 = j0;
         }
     }
 }
@@ -12,10 +12,152 @@
 #define TLAPACK_BLAS_TRSV_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemv.hpp"
 #include "tlapack/lapack/conjugate.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /// Solves op(A) x = b without blocking. @see trsv()
+    template <class matrixA_t, class vectorX_t>
+    void trsv_unblocked(
+        Uplo uplo, Op trans, Diag diag, const matrixA_t& A, vectorX_t& x)
+    {
+        // data traits
+        using TA = type_t<matrixA_t>;
+        using TX = type_t<vectorX_t>;
+        using idx_t = size_type<matrixA_t>;
+
+        // constants
+        const idx_t n = nrows(A);
+        const bool nonunit = (diag == Diag::NonUnit);
+
+        if (trans == Op::NoTrans) {
+            // Form x := A^{-1} * x
+            if (uplo == Uplo::Upper) {
+                // upper
+                for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                    // note: NOT skipping if x[j] is zero, for consistent NAN
+                    // handling
+                    if (nonunit) {
+                        x[j] /= A(j, j);
+                    }
+                    for (idx_t i = j - 1; i != idx_t(-1); --i) {
+                        x[i] -= x[j] * A(i, j);
+                    }
+                }
+            }
+            else {
+                // lower
+                for (idx_t j = 0; j < n; ++j) {
+                    // note: NOT skipping if x[j] is zero ...
+                    if (nonunit) {
+                        x[j] /= A(j, j);
+                    }
+                    for (idx_t i = j + 1; i < n; ++i) {
+                        x[i] -= x[j] * A(i, j);
+                    }
+                }
+            }
+        }
+        else if (trans == Op::Conj) {
+            // Form x := A^{-1} * x
+            if (uplo == Uplo::Upper) {
+                // upper
+                for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                    // note: NOT skipping if x[j] is zero, for consistent NAN
+                    // handling
+                    if (nonunit) {
+                        x[j] /= conj(A(j, j));
+                    }
+                    for (idx_t i = j - 1; i != idx_t(-1); --i) {
+                        x[i] -= x[j] * conj(A(i, j));
+                    }
+                }
+            }
+            else {
+                // lower
+                for (idx_t j = 0; j < n; ++j) {
+                    // note: NOT skipping if x[j] is zero ...
+                    if (nonunit) {
+                        x[j] /= conj(A(j, j));
+                    }
+                    for (idx_t i = j + 1; i < n; ++i) {
+                        x[i] -= x[j] * conj(A(i, j));
+                    }
+                }
+            }
+        }
+        else if (trans == Op::Trans) {
+            // Form  x := A^{-T} * x
+
+            using scalar_t = scalar_type<TA, TX>;
+
+            if (uplo == Uplo::Upper) {
+                // upper
+                for (idx_t j = 0; j < n; ++j) {
+                    scalar_t tmp = x[j];
+                    for (idx_t i = 0; i < j; ++i) {
+                        tmp -= A(i, j) * x[i];
+                    }
+                    if (nonunit) {
+                        tmp /= A(j, j);
+                    }
+                    x[j] = tmp;
+                }
+            }
+            else {
+                // lower
+                for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                    scalar_t tmp = x[j];
+                    for (idx_t i = j + 1; i < n; ++i) {
+                        tmp -= A(i, j) * x[i];
+                    }
+                    if (nonunit) {
+                        tmp /= A(j, j);
+                    }
+                    x[j] = tmp;
+                }
+            }
+        }
+        else {
+            // Form x := A^{-H} * x
+            // same code as above A^{-T} * x case, except add conj()
+
+            using scalar_t = scalar_type<TA, TX>;
+
+            if (uplo == Uplo::Upper) {
+                // upper
+                for (idx_t j = 0; j < n; ++j) {
+                    scalar_t tmp = x[j];
+                    for (idx_t i = 0; i < j; ++i) {
+                        tmp -= conj(A(i, j)) * x[i];
+                    }
+                    if (nonunit) {
+                        tmp /= conj(A(j, j));
+                    }
+                    x[j] = tmp;
+                }
+            }
+            else {
+                // lower
+                for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                    scalar_t tmp = x[j];
+                    for (idx_t i = j + 1; i < n; ++i) {
+                        tmp -= conj(A(i, j)) * x[i];
+                    }
+                    if (nonunit) {
+                        tmp /= conj(A(j, j));
+                    }
+                    x[j] = tmp;
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
 /**
  * Solve the triangular matrix-vector equation
  * \[
@@ -31,6 +173,11 @@ namespace tlapack {
  * No test for singularity or near-singularity is included in this
  * routine. Such tests must be performed before calling this routine.
  *
+ * A is processed in diagonal blocks of order 64. Each block is solved with
+ * the unblocked substitution, and the remaining entries of x are updated
+ * with gemv(), which is parallel for large matrices when TLAPACK_USE_OPENMP
+ * is defined.
+ *
  * @param[in] uplo
  *     What part of the matrix A is referenced,
  *     the opposite triangle being assumed to be zero.
@@ -65,12 +212,14 @@ void trsv(Uplo uplo, Op trans, Diag diag, const matrixA_t& A, vectorX_t& x)
 {
     // data traits
     using TA = type_t<matrixA_t>;
-    using TX = type_t<vectorX_t>;
     using idx_t = size_type<matrixA_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<TA>;
 
     // constants
+    const real_t one(1);
     const idx_t n = nrows(A);
-    const bool nonunit = (diag == Diag::NonUnit);
+    const idx_t nb = internal::triangular_matvec_block;
 
     // check arguments
     tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
@@ -80,125 +229,54 @@ void trsv(Uplo uplo, Op trans, Diag diag, const matrixA_t& A, vectorX_t& x)
     tlapack_check_false(nrows(A) != ncols(A));
     tlapack_check_false(size(x) != n);
 
-    if (trans == Op::NoTrans) {
-        // Form x := A^{-1} * x
-        if (uplo == Uplo::Upper) {
-            // upper
-            for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                // note: NOT skipping if x[j] is zero, for consistent NAN
-                // handling
-                if (nonunit) {
-                    x[j] /= A(j, j);
-                }
-                for (idx_t i = j - 1; i != idx_t(-1); --i) {
-                    x[i] -= x[j] * A(i, j);
-                }
-            }
-        }
-        else {
-            // lower
-            for (idx_t j = 0; j < n; ++j) {
-                // note: NOT skipping if x[j] is zero ...
-                if (nonunit) {
-                    x[j] /= A(j, j);
-                }
-                for (idx_t i = j + 1; i < n; ++i) {
-                    x[i] -= x[j] * A(i, j);
-                }
-            }
-        }
-    }
-    else if (trans == Op::Conj) {
-        // Form x := A^{-1} * x
-        if (uplo == Uplo::Upper) {
-            // upper
-            for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                // note: NOT skipping if x[j] is zero, for consistent NAN
-                // handling
-                if (nonunit) {
-                    x[j] /= conj(A(j, j));
-                }
-                for (idx_t i = j - 1; i != idx_t(-1); --i) {
-                    x[i] -= x[j] * conj(A(i, j));
-                }
-            }
-        }
-        else {
-            // lower
-            for (idx_t j = 0; j < n; ++j) {
-                // note: NOT skipping if x[j] is zero ...
-                if (nonunit) {
-                    x[j] /= conj(A(j, j));
-                }
-                for (idx_t i = j + 1; i < n; ++i) {
-                    x[i] -= x[j] * conj(A(i, j));
-                }
-            }
-        }
-    }
-    else if (trans == Op::Trans) {
-        // Form  x := A^{-T} * x
+    // Small matrices
+    if (n <= nb) return internal::trsv_unblocked(uplo, trans, diag, A, x);
 
-        using scalar_t = scalar_type<TA, TX>;
+    // Forward substitution if op(A) is lower triangular
+    const bool forward = ((uplo == Uplo::Lower) ==
+                          (trans == Op::NoTrans || trans == Op::Conj));
 
-        if (uplo == Uplo::Upper) {
-            // upper
-            for (idx_t j = 0; j < n; ++j) {
-                scalar_t tmp = x[j];
-                for (idx_t i = 0; i < j; ++i) {
-                    tmp -= A(i, j) * x[i];
-                }
-                if (nonunit) {
-                    tmp /= A(j, j);
-                }
-                x[j] = tmp;
-            }
-        }
-        else {
-            // lower
-            for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                scalar_t tmp = x[j];
-                for (idx_t i = j + 1; i < n; ++i) {
-                    tmp -= A(i, j) * x[i];
-                }
-                if (nonunit) {
-                    tmp /= A(j, j);
-                }
-                x[j] = tmp;
+    if (forward) {
+        for (idx_t j0 = 0; j0 < n; j0 += nb) {
+            const idx_t j1 = min(n, j0 + nb);
+            auto x1 = slice(x, range{j0, j1});
+
+            // x1 := op(A11)^{-1} x1
+            internal::trsv_unblocked(
+                uplo, trans, diag, slice(A, range{j0, j1}, range{j0, j1}), x1);
+
+            // x2 := x2 - op(A21) x1
+            if (j1 < n) {
+                auto x2 = slice(x, range{j1, n});
+                if (uplo == Uplo::Lower)
+                    gemv(trans, -one, slice(A, range{j1, n}, range{j0, j1}),
+                         x1, one, x2);
+                else
+                    gemv(trans, -one, slice(A, range{j0, j1}, range{j1, n}),
+                         x1, one, x2);
             }
         }
     }
     else {
-        // Form x := A^{-H} * x
-        // same code as above A^{-T} * x case, except add conj()
+        for (idx_t j1 = n; j1 > 0;) {
+            const idx_t j0 = (j1 > nb) ? j1 - nb : 0;
+            auto x1 = slice(x, range{j0, j1});
 
-        using scalar_t = scalar_type<TA, TX>;
+            // x1 := op(A11)^{-1} x1
+            internal::trsv_unblocked(
+                uplo, trans, diag, slice(A, range{j0, j1}, range{j0, j1}), x1);
 
-        if (uplo == Uplo::Upper) {
-            // upper
-            for (idx_t j = 0; j < n; ++j) {
-                scalar_t tmp = x[j];
-                for (idx_t i = 0; i < j; ++i) {
-                    tmp -= conj(A(i, j)) * x[i];
-                }
-                if (nonunit) {
-                    tmp /= conj(A(j, j));
-                }
-                x[j] = tmp;
-            }
-        }
-        else {
-            // lower
-            for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                scalar_t tmp = x[j];
-                for (idx_t i = j + 1; i < n; ++i) {
-                    tmp -= conj(A(i, j)) * x[i];
-                }
-                if (nonunit) {
-                    tmp /= conj(A(j, j));
-                }
-                x[j] = tmp;
+            // x0 := x0 - op(A01) x1
+            if (j0 > 0) {
+                auto x0 = slice(x, range{0, j0});
+                if (uplo == Uplo::Upper)
+                    gemv(trans, -one, slice(A, range{0, j0}, range{j0, j1}),
+                         x1, one, x0);
+                else
+                    gemv(trans, -one, slice(A, range{j0, j1}, range{0, j0}),
+                         x1, one, x0);
             }
+            j1 = j0;
         }
     }
 }
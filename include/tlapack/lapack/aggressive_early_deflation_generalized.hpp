@@ -21,6 +21,7 @@
 #include "tlapack/lapack/larfg.hpp"
 #include "tlapack/lapack/laset.hpp"
 #include "tlapack/lapack/multishift_qz.hpp"
+#include "tlapack/lapack/qz_offwindow_update.hpp"
 
 namespace tlapack {
 
@@ -170,15 +171,17 @@ void aggressive_early_deflation_generalized(bool want_s,
     }
 
     // Define workspace matrices
-    // We use the lower triangular part of A as workspace
-    // AW and WH overlap, but WH is only used after we no longer need
-    // AW so it is ok.
+    // We use the lower triangular parts of A and B as workspace
+    // Aw and WHA overlap, but WHA is only used after we no longer need
+    // Aw so it is ok. The same holds for Bw and WHB.
     auto Qc = slice(A, range{n - jw, n}, range{0, jw});
     auto Zc = slice(B, range{n - jw, n}, range{0, jw});
     auto Aw = slice(A, range{n - jw, n}, range{jw, 2 * jw});
     auto Bw = slice(B, range{n - jw, n}, range{jw, 2 * jw});
-    auto WH = slice(A, range{n - jw, n}, range{jw, n - jw - 3});
-    auto WV = slice(A, range{jw + 3, n - jw}, range{0, jw});
+    auto WHA = slice(A, range{n - jw, n}, range{jw, n - jw - 3});
+    auto WHB = slice(B, range{n - jw, n}, range{jw, n - jw - 3});
+    auto WVA = slice(A, range{jw + 3, n - jw}, range{0, jw});
+    auto WVB = slice(B, range{jw + 3, n - jw}, range{0, jw});
 
     // Convert the window to spike-triangular form. i.e. calculate the
     // Schur form of the deflation window.
@@ -380,83 +383,9 @@ void aggressive_early_deflation_generalized(bool want_s,
         istart_m = ilo;
         istop_m = ihi;
     }
-    // Update A
-    if (ihi < istop_m) {
-        idx_t i = ihi;
-        while (i < istop_m) {
-            idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-            auto A_slice = slice(A, range{kwtop, ihi}, range{i, i + iblock});
-            auto WH_slice =
-                slice(WH, range{0, nrows(A_slice)}, range{0, ncols(A_slice)});
-            gemm(CONJ_TRANS, NO_TRANS, one, Qc, A_slice, WH_slice);
-            lacpy(GENERAL, WH_slice, A_slice);
-            i = i + iblock;
-        }
-    }
-    if (istart_m < kwtop) {
-        idx_t i = istart_m;
-        while (i < kwtop) {
-            idx_t iblock = std::min<idx_t>(kwtop - i, nrows(WV));
-            auto A_slice = slice(A, range{i, i + iblock}, range{kwtop, ihi});
-            auto WV_slice =
-                slice(WV, range{0, nrows(A_slice)}, range{0, ncols(A_slice)});
-            gemm(NO_TRANS, NO_TRANS, one, A_slice, Zc, WV_slice);
-            lacpy(GENERAL, WV_slice, A_slice);
-            i = i + iblock;
-        }
-    }
-    // Update B
-    if (ihi < istop_m) {
-        idx_t i = ihi;
-        while (i < istop_m) {
-            idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-            auto B_slice = slice(B, range{kwtop, ihi}, range{i, i + iblock});
-            auto WH_slice =
-                slice(WH, range{0, nrows(B_slice)}, range{0, ncols(B_slice)});
-            gemm(CONJ_TRANS, NO_TRANS, one, Qc, B_slice, WH_slice);
-            lacpy(GENERAL, WH_slice, B_slice);
-            i = i + iblock;
-        }
-    }
-    if (istart_m < kwtop) {
-        idx_t i = istart_m;
-        while (i < kwtop) {
-            idx_t iblock = std::min<idx_t>(kwtop - i, nrows(WV));
-            auto B_slice = slice(B, range{i, i + iblock}, range{kwtop, ihi});
-            auto WV_slice =
-                slice(WV, range{0, nrows(B_slice)}, range{0, ncols(B_slice)});
-            gemm(NO_TRANS, NO_TRANS, one, B_slice, Zc, WV_slice);
-            lacpy(GENERAL, WV_slice, B_slice);
-            i = i + iblock;
-        }
-    }
-    // Update Q
-    if (want_q) {
-        idx_t i = 0;
-        while (i < n) {
-            idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-            auto Q_slice = slice(Q, range{i, i + iblock}, range{kwtop, ihi});
-            auto WV_slice =
-                slice(WV, range{0, nrows(Q_slice)}, range{0, ncols(Q_slice)});
-            gemm(NO_TRANS, NO_TRANS, one, Q_slice, Qc, WV_slice);
-            lacpy(GENERAL, WV_slice, Q_slice);
-            i = i + iblock;
-        }
-    }
-    // Update Z
-    if (want_z) {
-        idx_t i = 0;
-        while (i < n) {
-            idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-            auto Z_slice = slice(Z, range{i, i + iblock}, range{kwtop, ihi});
-            auto WV_slice =
-                slice(WV, range{0, nrows(Z_slice)}, range{0, ncols(Z_slice)});
-            gemm(NO_TRANS, NO_TRANS, one, Z_slice, Zc, WV_slice);
-            lacpy(GENERAL, WV_slice, Z_slice);
-            i = i + iblock;
-        }
-    }
-}  // namespace tlapack
+    qz_offwindow_update(want_q, want_z, istart_m, istop_m, kwtop, kwtop, A, B,
+                        Q, Z, Qc, Zc, WHA, WHB, WVA, WVB);
+}
 
 }  // namespace tlapack
 
@@ -0,0 +1,204 @@
+/// @file compact_wy.hpp Compact WY representation of a product of
+/// Householder reflectors
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_COMPACT_WY_HH
+#define TLAPACK_COMPACT_WY_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/unmq.hpp"
+
+namespace tlapack {
+
+/** Unitary matrix Q stored in compact WY form.
+ *
+ * Q is a product of k elementary reflectors, as in unmq(). The object owns a
+ * contiguous copy of the reflectors V, the scalar factors tau and the
+ * triangular factors of the block reflectors, computed once by
+ * unmq_form_tt() on construction. Q can then be applied any number of times
+ * with apply() without forming the triangular factors again. The workspace
+ * of apply() is kept between calls.
+ *
+ * Example: after geqrf(A, tau),
+ * @code{.cpp}
+ * CompactWY<matrix_t> Q(Direction::Forward, StoreV::Columnwise,
+ *                       cols(A, range{0, k}), tau);
+ * Q.apply(Side::Left, Op::ConjTrans, C);  // C := Q^H C
+ * @endcode
+ * For the Q of gehrd(), use the reflectors in A(1:n,0:n-1) and apply Q to
+ * the rows or columns 1:n of C.
+ *
+ * @tparam matrix_t Matrix type used for the storage of the object.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t>
+class CompactWY {
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    using storage_matrix_t = decltype(Create<matrix_t>()(
+        std::declval<std::vector<T>&>(), idx_t(0), idx_t(0)));
+    using storage_vector_t = decltype(Create<vector_type<matrix_t>>()(
+        std::declval<std::vector<T>&>(), idx_t(0)));
+
+   public:
+    // ---------------------------------------------------------------------
+    // Constructors
+
+    /** Stores the reflectors and forms the triangular factors
+     *
+     * @param[in] direction
+     *     Indicates how Q is formed from a product of elementary reflectors.
+     *     - Direction::Forward:  $Q = H_1 H_2 ... H_k$.
+     *     - Direction::Backward: $Q = H_k ... H_2 H_1$.
+     *
+     * @param[in] storeMode
+     *     Indicates how the vectors which define the elementary reflectors
+     *     are stored:
+     *     - StoreV::Columnwise: V is nQ-by-k.
+     *     - StoreV::Rowwise:    V is k-by-nQ.
+     *
+     * @param[in] V Matrix of reflectors, as in unmq().
+     *
+     * @param[in] tau Vector of length k.
+     *      Scalar factors of the elementary reflectors.
+     *
+     * @param[in] opts Options.
+     *      - @c opts.nb: Number of reflectors in each block.
+     *      - @c opts.nc: Panel size used by apply(). @see unmq_tt()
+     */
+    template <TLAPACK_SMATRIX matrixV_t, TLAPACK_SVECTOR vector_t>
+    CompactWY(Direction direction,
+              StoreV storeMode,
+              const matrixV_t& V,
+              const vector_t& tau,
+              const UnmqOpts& opts = {})
+        : dir(direction),
+          storage(storeMode),
+          unmqOpts(opts),
+          Vmat(Create<matrix_t>()(Vdata, (idx_t)nrows(V), (idx_t)ncols(V))),
+          tauvec(Create<vector_type<matrix_t>>()(taudata, (idx_t)size(tau))),
+          TTmat(Create<matrix_t>()(
+              TTdata,
+              (idx_t)size(tau),
+              max<idx_t>(1, min<idx_t>(opts.nb, (idx_t)size(tau)))))
+    {
+        const idx_t k = size(tau);
+
+        // check arguments
+        tlapack_check(direction == Direction::Forward ||
+                      direction == Direction::Backward);
+        tlapack_check(storeMode == StoreV::Columnwise ||
+                      storeMode == StoreV::Rowwise);
+        tlapack_check((storeMode == StoreV::Columnwise) ? (ncols(V) == k)
+                                                        : (nrows(V) == k));
+
+        lacpy(GENERAL, V, Vmat);
+        for (idx_t i = 0; i < k; ++i)
+            tauvec[i] = tau[i];
+
+        unmq_form_tt(dir, storage, Vmat, tauvec, TTmat);
+    }
+
+    // The views may point to the owned storage, so copies are not allowed
+    CompactWY(const CompactWY&) = delete;
+    CompactWY& operator=(const CompactWY&) = delete;
+    CompactWY(CompactWY&&) = default;
+    CompactWY& operator=(CompactWY&&) = default;
+
+    // ---------------------------------------------------------------------
+    // Operations
+
+    /** Applies Q to a matrix C
+     *
+     * @param[in] side Specifies which side op(Q) is to be applied.
+     *      - Side::Left:  C := op(Q) C;
+     *      - Side::Right: C := C op(Q).
+     *
+     * @param[in] trans The operation $op(Q)$ to be used:
+     *      - Op::NoTrans:      $op(Q) = Q$;
+     *      - Op::ConjTrans:    $op(Q) = Q^H$.
+     *
+     * @param[in,out] C m-by-n matrix. m = nQ if side = Side::Left, and
+     *      n = nQ if side = Side::Right.
+     *
+     * @return 0 if success.
+     */
+    template <TLAPACK_SMATRIX matrixC_t>
+    int apply(Side side, Op trans, matrixC_t& C)
+    {
+        const WorkInfo workinfo = unmq_tt_worksize<T>(
+            side, trans, dir, storage, Vmat, TTmat, C, unmqOpts);
+        auto work = Create<matrix_t>()(workdata, (idx_t)workinfo.m,
+                                       (idx_t)workinfo.n);
+
+        return unmq_tt_work(side, trans, dir, storage, Vmat, TTmat, C, work,
+                            unmqOpts);
+    }
+
+    /** Forms the leading columns of Q explicitly
+     *
+     * @param[out] Q nQ-by-n matrix, n <= nQ.
+     *      On exit, the first n columns of Q.
+     *
+     * @return 0 if success.
+     */
+    template <TLAPACK_SMATRIX matrixQ_t>
+    int form_q(matrixQ_t& Q)
+    {
+        using TQ = type_t<matrixQ_t>;
+
+        // check arguments
+        tlapack_check(nrows(Q) == nQ());
+        tlapack_check(ncols(Q) <= nrows(Q));
+
+        laset(GENERAL, TQ(0), TQ(1), Q);
+        return apply(Side::Left, Op::NoTrans, Q);
+    }
+
+    // ---------------------------------------------------------------------
+    // Accessors
+
+    /// Direction of the product of reflectors
+    constexpr Direction direction() const noexcept { return dir; }
+
+    /// Storage of the reflectors
+    constexpr StoreV storeMode() const noexcept { return storage; }
+
+    /// Order of Q
+    constexpr idx_t nQ() const noexcept
+    {
+        return (storage == StoreV::Columnwise) ? nrows(Vmat) : ncols(Vmat);
+    }
+
+    /// Copy of the matrix of reflectors
+    constexpr const storage_matrix_t& V() const noexcept { return Vmat; }
+
+    /// Scalar factors of the reflectors
+    constexpr const storage_vector_t& tau() const noexcept { return tauvec; }
+
+    /// Triangular factors of the block reflectors, @see unmq_form_tt()
+    constexpr const storage_matrix_t& TT() const noexcept { return TTmat; }
+
+   private:
+    Direction dir;      ///< Direction of the product of reflectors
+    StoreV storage;     ///< Storage of the reflectors
+    UnmqOpts unmqOpts;  ///< Options for unmq_tt()
+    std::vector<T> Vdata, taudata, TTdata, workdata;  ///< Owned memory
+    storage_matrix_t Vmat;    ///< Reflectors
+    storage_vector_t tauvec;  ///< Scalar factors
+    storage_matrix_t TTmat;   ///< Triangular factors
+};
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_COMPACT_WY_HH
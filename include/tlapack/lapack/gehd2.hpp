@@ -13,7 +13,12 @@
 #define TLAPACK_GEHD2_HH
 
 #include "tlapack/base/utils.hpp"
-#include "tlapack/lapack/larf.hpp"
+#include "tlapack/blas/axpy.hpp"
+#include "tlapack/blas/dot.hpp"
+#include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/gemv2.hpp"
+#include "tlapack/blas/ger.hpp"
+#include "tlapack/blas/ger2.hpp"
 #include "tlapack/lapack/larfg.hpp"
 
 namespace tlapack {
@@ -40,23 +45,16 @@ constexpr WorkInfo gehd2_worksize(size_type<matrix_t> ilo,
                                   const matrix_t& A,
                                   const vector_t& tau)
 {
+    using work_t = matrix_type<matrix_t, vector_t>;
     using idx_t = size_type<matrix_t>;
-    using range = pair<idx_t, idx_t>;
 
     // constants
     const idx_t n = ncols(A);
 
     WorkInfo workinfo;
-    if (ilo + 1 < ihi && n > 0) {
-        auto&& v = slice(A, range{ilo + 1, ihi}, ilo);
-
-        auto&& C0 = slice(A, range{0, ihi}, range{ilo + 1, ihi});
-        workinfo = larf_worksize<T>(RIGHT_SIDE, FORWARD, COLUMNWISE_STORAGE, v,
-                                    tau[0], C0);
-
-        auto&& C1 = slice(A, range{ilo + 1, ihi}, range{ilo + 1, n});
-        workinfo.minMax(larf_worksize<T>(LEFT_SIDE, FORWARD, COLUMNWISE_STORAGE,
-                                         v, tau[0], C1));
+    if constexpr (is_same_v<T, type_t<work_t>>) {
+        if (ilo + 1 < ihi && n > 0)
+            workinfo = WorkInfo(max<idx_t>(ihi, n - ilo - 1), 2);
     }
 
     return workinfo;
@@ -79,10 +77,13 @@ int gehd2_work(size_type<matrix_t> ilo,
                vector_t& tau,
                work_t& work)
 {
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
     using idx_t = size_type<matrix_t>;
     using range = pair<idx_t, idx_t>;
 
     // constants
+    const real_t one(1);
     const idx_t n = ncols(A);
 
     // check arguments
@@ -90,7 +91,10 @@ int gehd2_work(size_type<matrix_t> ilo,
     tlapack_check_false((idx_t)size(tau) < n - 1);
 
     // quick return
-    if (n <= 0) return 0;
+    if (n <= 0 || ilo + 1 >= ihi) return 0;
+
+    // Vectors w and z
+    auto [W, work1] = reshape(work, max<idx_t>(ihi, n - ilo - 1), 2);
 
     for (idx_t i = ilo; i < ihi - 1; ++i) {
         // Define v := A[i+1:ihi,i]
@@ -98,15 +102,40 @@ int gehd2_work(size_type<matrix_t> ilo,
 
         // Generate the (i+1)-th elementary Householder reflection on v
         larfg(FORWARD, COLUMNWISE_STORAGE, v, tau[i]);
-
-        // Apply Householder reflection from the right to A[0:ihi,i+1:ihi]
-        auto C0 = slice(A, range{0, ihi}, range{i + 1, ihi});
-        larf_work(RIGHT_SIDE, FORWARD, COLUMNWISE_STORAGE, v, tau[i], C0, work);
-
-        // Apply Householder reflection from the left to A[i+1:ihi,i+1:n-1]
-        auto C1 = slice(A, range{i + 1, ihi}, range{i + 1, n});
-        larf_work(LEFT_SIDE, FORWARD, COLUMNWISE_STORAGE, v, conj(tau[i]), C1,
-                  work);
+        const T alpha = v[0];
+        v[0] = one;
+
+        // The reflection is applied from the right to A[0:ihi,i+1:ihi] and
+        // from the left to A[i+1:ihi,i+1:n]. The two applications overlap in
+        // the block S = A[i+1:ihi,i+1:ihi], which is read once for the
+        // products with v and updated once with a rank-2 update
+        const idx_t k = ihi - i - 1;
+        auto S = slice(A, range{i + 1, ihi}, range{i + 1, ihi});
+        auto w = slice(W, range{0, ihi}, 0);
+        auto z = slice(W, range{0, n - i - 1}, 1);
+        auto wS = slice(w, range{i + 1, ihi});
+        auto zS = slice(z, range{0, k});
+
+        // w := A[0:ihi,i+1:ihi] v and z := A[i+1:ihi,i+1:n]^H v
+        gemv2(NO_TRANS, CONJ_TRANS, one, S, v, v, wS, zS);
+        auto C0 = slice(A, range{0, i + 1}, range{i + 1, ihi});
+        auto w0 = slice(w, range{0, i + 1});
+        gemv(NO_TRANS, one, C0, v, w0);
+        auto C1 = slice(A, range{i + 1, ihi}, range{ihi, n});
+        auto z1 = slice(z, range{k, n - i - 1});
+        if (ihi < n) gemv(CONJ_TRANS, one, C1, v, z1);
+
+        // The left reflection is applied after the right one, which changes
+        // S^H v by -conj(tau) v (wS^H v)
+        axpy(-conj(tau[i]) * dot(wS, v), v, zS);
+
+        // A[0:ihi,i+1:ihi] := A[0:ihi,i+1:ihi] - tau w v^H and
+        // A[i+1:ihi,i+1:n] := A[i+1:ihi,i+1:n] - conj(tau) v z^H
+        ger2(-tau[i], wS, v, -conj(tau[i]), v, zS, S);
+        ger(-tau[i], w0, v, C0);
+        if (ihi < n) ger(-conj(tau[i]), v, z1, C1);
+
+        v[0] = alpha;
     }
 
     return 0;
@@ -129,6 +158,11 @@ int gehd2_work(size_type<matrix_t> ilo,
  * with v[i+2] through v[ihi] stored on exit below the diagonal
  * in the ith column of A, and tau in tau[i].
  *
+ * Each H_i is applied from both sides with a pair of matrix-vector products,
+ * gemv2(), and a rank-2 update, ger2(), on the trailing block
+ * A[i+1:ihi,i+1:ihi], so that this block is swept twice per step instead of
+ * four times.
+ *
  * @return  0 if success
  *
  * @param[in] ilo integer
@@ -13,9 +13,12 @@
 #define TLAPACK_GGHD3_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/rot.hpp"
 #include "tlapack/blas/rotg.hpp"
 #include "tlapack/lapack/hessenberg_rq.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
 #include "tlapack/lapack/rot_sequence.hpp"
 
 namespace tlapack {
@@ -24,54 +27,91 @@ namespace tlapack {
  * Options struct for gghd3
  */
 struct Gghd3Opts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = 32;   ///< Block size
+    size_t nc = 256;  ///< Maximum number of rows or columns in each chunk of
+                      ///< the off-window updates. Chunks are independent and
+                      ///< may be processed in parallel.
 };
 
-/** Reduces a pair of real square matrices (A, B) to generalized upper
- *  Hessenberg form using unitary transformations, where A is a general matrix
- *  and B is upper triangular.
- *
- * @return  0 if success
+/** Worspace query of gghd3()
  *
  * @param[in] wantq boolean
  * @param[in] wantz boolean
  * @param[in] ilo integer
  * @param[in] ihi integer
- * @param[in,out] A n-by-n matrix.
- * @param[in,out] B n-by-n matrix.
- * @param[in,out] Q n-by-n matrix.
- * @param[in,out] Z n-by-n matrix.
+ * @param[in] A n-by-n matrix.
+ * @param[in] B n-by-n matrix.
+ * @param[in] Q n-by-n matrix.
+ * @param[in] Z n-by-n matrix.
  * @param[in] opts Options.
  *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SMATRIX A_t,
+          TLAPACK_SMATRIX B_t,
+          TLAPACK_SMATRIX Q_t,
+          TLAPACK_SMATRIX Z_t>
+constexpr WorkInfo gghd3_worksize(bool wantq,
+                                  bool wantz,
+                                  size_type<A_t> ilo,
+                                  size_type<A_t> ihi,
+                                  const A_t& A,
+                                  const B_t& B,
+                                  const Q_t& Q,
+                                  const Z_t& Z,
+                                  const Gghd3Opts& opts = {})
+{
+    using idx_t = size_type<A_t>;
+
+    const idx_t n = ncols(A);
+    const idx_t nh = ihi - ilo - 1;
+
+    if (nh <= 1) return WorkInfo();
+
+    const idx_t nb = min<idx_t>(opts.nb, nh - 1);
+
+    // Cosines and sines of the left and right rotations, the accumulated
+    // unitary factor and the buffers for the off-window updates
+    return WorkInfo(4 * (nh - 1) * nb + 4 * nb * nb + 10 * nb * n);
+}
+
+/** @copybrief gghd3()
+ * Workspace is provided as an argument.
+ * @copydetails gghd3()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
  * @ingroup computational
  */
 template <TLAPACK_SMATRIX A_t,
           TLAPACK_SMATRIX B_t,
           TLAPACK_SMATRIX Q_t,
-          TLAPACK_SMATRIX Z_t>
-int gghd3(bool wantq,
-          bool wantz,
-          size_type<A_t> ilo,
-          size_type<A_t> ihi,
-          A_t& A,
-          B_t& B,
-          Q_t& Q,
-          Z_t& Z,
-          const Gghd3Opts& opts = {})
+          TLAPACK_SMATRIX Z_t,
+          TLAPACK_WORKSPACE work_t>
+int gghd3_work(bool wantq,
+               bool wantz,
+               size_type<A_t> ilo,
+               size_type<A_t> ihi,
+               A_t& A,
+               B_t& B,
+               Q_t& Q,
+               Z_t& Z,
+               work_t& work,
+               const Gghd3Opts& opts = {})
 {
     using idx_t = size_type<A_t>;
     using range = pair<idx_t, idx_t>;
     using T = type_t<A_t>;
     using real_t = real_type<T>;
-    using r_matrix_t = real_type<A_t>;
-
-    Create<A_t> new_matrix;
-    Create<r_matrix_t> new_real_matrix;
 
     // constants
+    const T one(1);
     const idx_t n = ncols(A);
-    const idx_t nb = opts.nb;
     const idx_t nh = ihi - ilo - 1;
+    const idx_t nc = max<idx_t>(1, opts.nc);
 
     // check arguments
     tlapack_check(ilo >= 0 && ilo < n);
@@ -79,10 +119,14 @@ int gghd3(bool wantq,
     tlapack_check(n == nrows(A));
     tlapack_check(n == ncols(B));
     tlapack_check(n == nrows(B));
-    tlapack_check(n == ncols(Q));
-    tlapack_check(n == nrows(Q));
-    tlapack_check(n == ncols(Z));
-    tlapack_check(n == nrows(Z));
+    if (wantq) {
+        tlapack_check(n == ncols(Q));
+        tlapack_check(n == nrows(Q));
+    }
+    if (wantz) {
+        tlapack_check(n == ncols(Z));
+        tlapack_check(n == nrows(Z));
+    }
 
     // Zero out lower triangle of B
     for (idx_t j = 0; j < n; ++j)
@@ -92,21 +136,102 @@ int gghd3(bool wantq,
     // quick return
     if (nh <= 1) return 0;
 
-    // Locally allocate workspace for now
-    std::vector<real_t> Cl_;
-    auto Cl = new_real_matrix(Cl_, nh - 1, nb);
-    std::vector<T> Sl_;
-    auto Sl = new_matrix(Sl_, nh - 1, nb);
-    std::vector<real_t> Cr_;
-    auto Cr = new_real_matrix(Cr_, nh - 1, nb);
-    std::vector<T> Sr_;
-    auto Sr = new_matrix(Sr_, nh - 1, nb);
-
-    std::vector<T> Qt_;
-    auto Qt = new_matrix(Qt_, 2 * nb, 2 * nb);
-    std::vector<T> C_;
-    auto C = new_matrix(C_, 2 * nb, n);
-    auto D = new_matrix(C_, n, 2 * nb);
+    const idx_t nb = min<idx_t>(opts.nb, nh - 1);
+
+    // Workspace. The cosines are real, but are stored in matrices of type T
+    // so that they can share the workspace with the other buffers.
+    auto [Cl, work1] = reshape(work, nh - 1, nb);
+    auto [Sl, work2] = reshape(work1, nh - 1, nb);
+    auto [Cr, work3] = reshape(work2, nh - 1, nb);
+    auto [Sr, work4] = reshape(work3, nh - 1, nb);
+    auto [Qt, work5] = reshape(work4, 2 * nb, 2 * nb);
+    auto [C, work6] = reshape(work5, 2 * nb, 2 * n);
+    auto [D, work7] = reshape(work6, 3 * n, 2 * nb);
+
+    // Applies the unitary factor Qt2 from the left to the rows i0:i0+nq of A
+    // (columns j0:n) and B (columns ihi:n), and from the right to the columns
+    // i0:i0+nq of Q. The updates are split into chunks of at most nc columns
+    // or rows. Each chunk uses its own part of the buffers C and D.
+    auto apply_left = [&](const auto& Qt2, idx_t i0, idx_t j0, auto& Cw,
+                          auto& Dw) {
+        const idx_t nq = ncols(Qt2);
+        const idx_t nchunksA = (n - j0 + nc - 1) / nc;
+        const idx_t nchunksB = (n - ihi + nc - 1) / nc;
+        const idx_t nchunksQ = (wantq) ? (n + nc - 1) / nc : 0;
+        const idx_t nchunks = nchunksA + nchunksB + nchunksQ;
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (idx_t k = 0; k < nchunks; ++k) {
+            if (k < nchunksA) {
+                const idx_t j1 = j0 + k * nc;
+                const idx_t j2 = min(j1 + nc, n);
+                auto A2 = slice(A, range(i0, i0 + nq), range(j1, j2));
+                auto C2 = slice(Cw, range(0, nq), range(j1 - j0, j2 - j0));
+                gemm(CONJ_TRANS, NO_TRANS, one, Qt2, A2, C2);
+                lacpy(GENERAL, C2, A2);
+            }
+            else if (k < nchunksA + nchunksB) {
+                const idx_t j1 = ihi + (k - nchunksA) * nc;
+                const idx_t j2 = min(j1 + nc, n);
+                const idx_t jc = (n - j0) + (j1 - ihi);
+                auto B2 = slice(B, range(i0, i0 + nq), range(j1, j2));
+                auto C2 = slice(Cw, range(0, nq), range(jc, jc + (j2 - j1)));
+                gemm(CONJ_TRANS, NO_TRANS, one, Qt2, B2, C2);
+                lacpy(GENERAL, C2, B2);
+            }
+            else {
+                const idx_t i1 = (k - nchunksA - nchunksB) * nc;
+                const idx_t i2 = min(i1 + nc, n);
+                auto Q2 = slice(Q, range(i1, i2), range(i0, i0 + nq));
+                auto D2 = slice(Dw, range(i1, i2), range(0, nq));
+                gemm(NO_TRANS, NO_TRANS, one, Q2, Qt2, D2);
+                lacpy(GENERAL, D2, Q2);
+            }
+        }
+    };
+
+    // Applies the unitary factor Qt2 from the right to the columns i0:i0+nq
+    // of A and B (rows 0:j0) and of Z. The updates are split into chunks of at
+    // most nc rows. Each chunk uses its own part of the buffer Dw.
+    auto apply_right = [&](const auto& Qt2, idx_t i0, idx_t j0, auto& Dw) {
+        const idx_t nq = ncols(Qt2);
+        const idx_t nchunksAB = (j0 + nc - 1) / nc;
+        const idx_t nchunksZ = (wantz) ? (n + nc - 1) / nc : 0;
+        const idx_t nchunks = 2 * nchunksAB + nchunksZ;
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (idx_t k = 0; k < nchunks; ++k) {
+            if (k < nchunksAB) {
+                const idx_t i1 = k * nc;
+                const idx_t i2 = min(i1 + nc, j0);
+                auto A2 = slice(A, range(i1, i2), range(i0, i0 + nq));
+                auto D2 = slice(Dw, range(i1, i2), range(0, nq));
+                gemm(NO_TRANS, NO_TRANS, one, A2, Qt2, D2);
+                lacpy(GENERAL, D2, A2);
+            }
+            else if (k < 2 * nchunksAB) {
+                const idx_t i1 = (k - nchunksAB) * nc;
+                const idx_t i2 = min(i1 + nc, j0);
+                auto B2 = slice(B, range(i1, i2), range(i0, i0 + nq));
+                auto D2 = slice(Dw, range(j0 + i1, j0 + i2), range(0, nq));
+                gemm(NO_TRANS, NO_TRANS, one, B2, Qt2, D2);
+                lacpy(GENERAL, D2, B2);
+            }
+            else {
+                const idx_t i1 = (k - 2 * nchunksAB) * nc;
+                const idx_t i2 = min(i1 + nc, n);
+                auto Z2 = slice(Z, range(i1, i2), range(i0, i0 + nq));
+                auto D2 =
+                    slice(Dw, range(2 * j0 + i1, 2 * j0 + i2), range(0, nq));
+                gemm(NO_TRANS, NO_TRANS, one, Z2, Qt2, D2);
+                lacpy(GENERAL, D2, Z2);
+            }
+        }
+    };
 
     for (idx_t j = ilo; j + 2 < ihi; j = j + nb) {
         // Number of columns to be reduced
@@ -123,7 +248,7 @@ int gghd3(bool wantq,
             // Update jb-th column of the block
             for (idx_t jbb = 0; jbb < jb; ++jbb) {
                 for (idx_t i = ihi - 1; i > j + jbb + 1; --i) {
-                    real_t c = Cl(i - ilo - 2, jbb);
+                    real_t c = real(Cl(i - ilo - 2, jbb));
                     T s = Sl(i - ilo - 2, jbb);
                     T temp = c * A(i - 1, j + jb) + s * A(i, j + jb);
                     A(i, j + jb) =
@@ -133,8 +258,9 @@ int gghd3(bool wantq,
             }
             // Reduce column in A
             for (idx_t i = ihi - 1; i > j + jb + 1; --i) {
-                rotg(A(i - 1, j + jb), A(i, j + jb), Cl(i - ilo - 2, jb),
-                     Sl(i - ilo - 2, jb));
+                real_t c;
+                rotg(A(i - 1, j + jb), A(i, j + jb), c, Sl(i - ilo - 2, jb));
+                Cl(i - ilo - 2, jb) = c;
                 A(i, j + jb) = (T)0;
             }
 
@@ -167,27 +293,12 @@ int gghd3(bool wantq,
                 for (idx_t i = nblst - 1; i > jb; --i) {
                     auto q1 = slice(Qt2, range(i - 1 - jb, nblst), i - 1);
                     auto q2 = slice(Qt2, range(i - 1 - jb, nblst), i);
-                    rot(q1, q2, Cl(j - ilo + nnb * n2nb + i - 1, jb),
+                    rot(q1, q2, real(Cl(j - ilo + nnb * n2nb + i - 1, jb)),
                         conj(Sl(j - ilo + nnb * n2nb + i - 1, jb)));
                 }
             }
 
-            auto A2 = slice(A, range(ihi - nblst, ihi), range(j + nnb, n));
-            auto C2 = slice(C, range(0, nblst), range(j + nnb, n));
-            gemm(CONJ_TRANS, NO_TRANS, (T)1, Qt2, A2, C2);
-            lacpy(GENERAL, C2, A2);
-
-            if (ihi < n) {
-                auto B2 = slice(B, range(ihi - nblst, ihi), range(ihi, n));
-                auto C3 = slice(C, range(0, nblst), range(ihi, n));
-                gemm(CONJ_TRANS, NO_TRANS, (T)1, Qt2, B2, C3);
-                lacpy(GENERAL, C3, B2);
-            }
-
-            auto Q2 = cols(Q, range(ihi - nblst, ihi));
-            auto D2 = cols(D, range(0, nblst));
-            gemm(NO_TRANS, NO_TRANS, (T)1, Q2, Qt2, D2);
-            lacpy(GENERAL, D2, Q2);
+            apply_left(Qt2, ihi - nblst, j + nnb, C, D);
         }
         for (idx_t ib = n2nb - 1; ib != (idx_t)-1; ib--) {
             auto Qt2 = slice(Qt, range(0, 2 * nnb), range(0, 2 * nnb));
@@ -197,32 +308,12 @@ int gghd3(bool wantq,
                     auto q1 =
                         slice(Qt2, range(i - 1 - jb, nnb + jb + 1), i - 1);
                     auto q2 = slice(Qt2, range(i - 1 - jb, nnb + jb + 1), i);
-                    rot(q1, q2, Cl(j - ilo + ib * nnb + i - 1, jb),
+                    rot(q1, q2, real(Cl(j - ilo + ib * nnb + i - 1, jb)),
                         conj(Sl(j - ilo + ib * nnb + i - 1, jb)));
                 }
             }
 
-            auto A2 =
-                slice(A, range(j + 1 + nnb * ib, j + 1 + nnb * ib + 2 * nnb),
-                      range(j + nnb, n));
-            auto C2 = slice(C, range(0, 2 * nnb), range(j + nnb, n));
-            gemm(CONJ_TRANS, NO_TRANS, (T)1, Qt2, A2, C2);
-            lacpy(GENERAL, C2, A2);
-
-            if (ihi < n) {
-                auto B2 = slice(
-                    B, range(j + 1 + nnb * ib, j + 1 + nnb * ib + 2 * nnb),
-                    range(ihi, n));
-                auto C3 = slice(C, range(0, 2 * nnb), range(ihi, n));
-                gemm(CONJ_TRANS, NO_TRANS, (T)1, Qt2, B2, C3);
-                lacpy(GENERAL, C3, B2);
-            }
-
-            auto Q2 =
-                cols(Q, range(j + 1 + nnb * ib, j + 1 + nnb * ib + 2 * nnb));
-            auto D2 = cols(D, range(0, 2 * nnb));
-            gemm(NO_TRANS, NO_TRANS, (T)1, Q2, Qt2, D2);
-            lacpy(GENERAL, D2, Q2);
+            apply_left(Qt2, j + 1 + nnb * ib, j + nnb, C, D);
         }
 
         //
@@ -238,26 +329,12 @@ int gghd3(bool wantq,
                 for (idx_t i = nblst - 1; i > jb; --i) {
                     auto q1 = slice(Qt2, range(i - 1 - jb, nblst), i - 1);
                     auto q2 = slice(Qt2, range(i - 1 - jb, nblst), i);
-                    rot(q1, q2, Cr(j - ilo + nnb * n2nb + i - 1, jb),
+                    rot(q1, q2, real(Cr(j - ilo + nnb * n2nb + i - 1, jb)),
                         conj(Sr(j - ilo + nnb * n2nb + i - 1, jb)));
                 }
             }
 
-            if (j > 0) {
-                auto A2 = slice(A, range(0, j), range(ihi - nblst, ihi));
-                auto D2 = slice(D, range(0, j), range(0, nblst));
-                gemm(NO_TRANS, NO_TRANS, (T)1, A2, Qt2, D2);
-                lacpy(GENERAL, D2, A2);
-
-                auto B2 = slice(B, range(0, j), range(ihi - nblst, ihi));
-                gemm(NO_TRANS, NO_TRANS, (T)1, B2, Qt2, D2);
-                lacpy(GENERAL, D2, B2);
-            }
-
-            auto Z2 = cols(Z, range(ihi - nblst, ihi));
-            auto D2 = cols(D, range(0, nblst));
-            gemm(NO_TRANS, NO_TRANS, (T)1, Z2, Qt2, D2);
-            lacpy(GENERAL, D2, Z2);
+            apply_right(Qt2, ihi - nblst, j, D);
         }
         for (idx_t ib = n2nb - 1; ib != (idx_t)-1; ib--) {
             auto Qt2 = slice(Qt, range(0, 2 * nnb), range(0, 2 * nnb));
@@ -267,37 +344,72 @@ int gghd3(bool wantq,
                     auto q1 =
                         slice(Qt2, range(i - 1 - jb, nnb + jb + 1), i - 1);
                     auto q2 = slice(Qt2, range(i - 1 - jb, nnb + jb + 1), i);
-                    rot(q1, q2, Cr(j - ilo + ib * nnb + i - 1, jb),
+                    rot(q1, q2, real(Cr(j - ilo + ib * nnb + i - 1, jb)),
                         conj(Sr(j - ilo + ib * nnb + i - 1, jb)));
                 }
             }
 
-            if (j > 0) {
-                auto A2 =
-                    slice(A, range(0, j),
-                          range(j + 1 + nnb * ib, j + 1 + nnb * ib + 2 * nnb));
-                auto D2 = slice(D, range(0, j), range(0, 2 * nnb));
-                gemm(NO_TRANS, NO_TRANS, (T)1, A2, Qt2, D2);
-                lacpy(GENERAL, D2, A2);
-
-                auto B2 =
-                    slice(B, range(0, j),
-                          range(j + 1 + nnb * ib, j + 1 + nnb * ib + 2 * nnb));
-                gemm(NO_TRANS, NO_TRANS, (T)1, B2, Qt2, D2);
-                lacpy(GENERAL, D2, B2);
-            }
-
-            auto Z2 =
-                cols(Z, range(j + 1 + nnb * ib, j + 1 + nnb * ib + 2 * nnb));
-            auto D2 = cols(D, range(0, 2 * nnb));
-            gemm(NO_TRANS, NO_TRANS, (T)1, Z2, Qt2, D2);
-            lacpy(GENERAL, D2, Z2);
+            apply_right(Qt2, j + 1 + nnb * ib, j, D);
         }
     }
 
     return 0;
 }
 
+/** Reduces a pair of real square matrices (A, B) to generalized upper
+ *  Hessenberg form using unitary transformations, where A is a general matrix
+ *  and B is upper triangular.
+ *
+ *  The rotations of each panel of opts.nb columns are accumulated into small
+ *  unitary matrices that are applied to the rest of A, B, Q and Z with
+ *  matrix-matrix multiplications. Those updates are split into independent
+ *  chunks of at most opts.nc rows or columns, which are processed in parallel
+ *  when <T>LAPACK is built with TLAPACK_USE_OPENMP.
+ *
+ * @return  0 if success
+ *
+ * @param[in] wantq boolean
+ *      If true, the left transformations are applied to Q.
+ * @param[in] wantz boolean
+ *      If true, the right transformations are applied to Z.
+ * @param[in] ilo integer
+ * @param[in] ihi integer
+ * @param[in,out] A n-by-n matrix.
+ * @param[in,out] B n-by-n matrix.
+ * @param[in,out] Q n-by-n matrix.
+ * @param[in,out] Z n-by-n matrix.
+ * @param[in] opts Options.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX A_t,
+          TLAPACK_SMATRIX B_t,
+          TLAPACK_SMATRIX Q_t,
+          TLAPACK_SMATRIX Z_t>
+int gghd3(bool wantq,
+          bool wantz,
+          size_type<A_t> ilo,
+          size_type<A_t> ihi,
+          A_t& A,
+          B_t& B,
+          Q_t& Q,
+          Z_t& Z,
+          const Gghd3Opts& opts = {})
+{
+    using T = type_t<A_t>;
+
+    // Functor
+    Create<A_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo =
+        gghd3_worksize<T>(wantq, wantz, ilo, ihi, A, B, Q, Z, opts);
+    std::vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return gghd3_work(wantq, wantz, ilo, ihi, A, B, Q, Z, work, opts);
+}
+
 }  // namespace tlapack
 
 #endif  // TLAPACK_GGHD3_HH
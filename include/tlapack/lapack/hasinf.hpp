@@ -11,12 +11,16 @@
 #define TLAPACK_HASINF_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/hasnan.hpp"
 
 namespace tlapack {
 
 /**
  * Returns true if and only if A has an infinite entry.
  *
+ * The entries are scanned in chunks, along the contiguous dimension of A,
+ * and the scan stops after the first chunk that contains an infinite entry.
+ *
  * @tparam uplo_t Type of access inside the algorithm.
  *      Either Uplo or any type that implements
  *          operator Uplo().
@@ -41,60 +45,15 @@ namespace tlapack {
 template <TLAPACK_UPLO uplo_t, TLAPACK_MATRIX matrix_t>
 bool hasinf(uplo_t uplo, const matrix_t& A)
 {
-    using idx_t = size_type<matrix_t>;
-
-    // constants
-    const idx_t m = nrows(A);
-    const idx_t n = ncols(A);
+    using T = type_t<matrix_t>;
 
     tlapack_check(uplo == Uplo::General || uplo == Uplo::UpperHessenberg ||
                   uplo == Uplo::LowerHessenberg || uplo == Uplo::Upper ||
                   uplo == Uplo::Lower || uplo == Uplo::StrictUpper ||
                   uplo == Uplo::StrictLower);
 
-    if (uplo == Uplo::UpperHessenberg) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < ((j < m) ? j + 2 : m); ++i)
-                if (isinf(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::Upper) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < ((j < m) ? j + 1 : m); ++i)
-                if (isinf(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::StrictUpper) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < ((j < m) ? j : m); ++i)
-                if (isinf(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::LowerHessenberg) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = ((j > 1) ? j - 1 : 0); i < m; ++i)
-                if (isinf(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::Lower) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = j; i < m; ++i)
-                if (isinf(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::StrictLower) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = j + 1; i < m; ++i)
-                if (isinf(A(i, j))) return true;
-        return false;
-    }
-    else  // if ( (Uplo) uplo == Uplo::General )
-    {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < m; ++i)
-                if (isinf(A(i, j))) return true;
-        return false;
-    }
+    return internal::any_entry([](const T& x) { return isinf(x); },
+                               Uplo(uplo), A);
 }
 
 /**
@@ -108,18 +67,10 @@ bool hasinf(uplo_t uplo, const matrix_t& A)
 template <TLAPACK_MATRIX matrix_t>
 bool hasinf(BandAccess accessType, const matrix_t& A) noexcept
 {
-    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
 
-    // constants
-    const idx_t m = nrows(A);
-    const idx_t n = ncols(A);
-    const idx_t kl = accessType.lower_bandwidth;
-    const idx_t ku = accessType.upper_bandwidth;
-
-    for (idx_t j = 0; j < n; ++j)
-        for (idx_t i = ((j >= ku) ? (j - ku) : 0); i < min(m, j + kl + 1); ++i)
-            if (isinf(A(i, j))) return true;
-    return false;
+    return internal::any_entry([](const T& x) { return isinf(x); },
+                               accessType, A);
 }
 
 /**
@@ -135,16 +86,14 @@ bool hasinf(BandAccess accessType, const matrix_t& A) noexcept
 template <TLAPACK_VECTOR vector_t>
 bool hasinf(const vector_t& x) noexcept
 {
+    using T = type_t<vector_t>;
     using idx_t = size_type<vector_t>;
 
-    // constants
-    const idx_t n = size(x);
-
-    for (idx_t i = 0; i < n; ++i)
-        if (isinf(x[i])) return true;
-    return false;
+    return internal::any_in_range([](const T& a) { return isinf(a); },
+                                  [&](idx_t i) { return x[i]; }, idx_t(0),
+                                  (idx_t)size(x));
 }
 
 }  // namespace tlapack
 
-#endif  // TLAPACK_HASINF_HH
\ No newline at end of file
+#endif  // TLAPACK_HASINF_HH
@@ -14,9 +14,148 @@
 
 namespace tlapack {
 
+namespace internal {
+
+    /// Number of entries that are tested between two checks for early exit
+    constexpr std::size_t scan_chunk = 64;
+
+    /** Returns true if pred(get(i)) is true for some i in [i0, i1).
+     *
+     * The entries are tested in chunks of scan_chunk entries without
+     * branching, so that the loop can be vectorized for built-in types, and
+     * the scan stops at the end of the first chunk with a hit.
+     *
+     * @ingroup auxiliary
+     */
+    template <class pred_t, class get_t, class idx_t>
+    bool any_in_range(pred_t pred, get_t get, idx_t i0, idx_t i1)
+    {
+        for (idx_t p = i0; p < i1; p += scan_chunk) {
+            const idx_t pe = min<idx_t>(p + scan_chunk, i1);
+            bool found = false;
+            for (idx_t i = p; i < pe; ++i)
+                found |= pred(get(i));
+            if (found) return true;
+        }
+        return false;
+    }
+
+    /** Returns true if pred(A(i,j)) is true for some entry accessed by uplo.
+     *
+     * Row-major matrices are scanned row by row, and all other matrices
+     * column by column, so that the inner loop runs over contiguous memory.
+     *
+     * @ingroup auxiliary
+     */
+    template <class pred_t, class matrix_t>
+    bool any_entry(pred_t pred, Uplo uplo, const matrix_t& A)
+    {
+        using idx_t = size_type<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // constants
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+
+        if constexpr (layout<matrix_t> == Layout::RowMajor) {
+            // Columns of row i that are accessed
+            auto rowRange = [&](idx_t i) -> range {
+                if (uplo == Uplo::UpperHessenberg)
+                    return range{(i > 0) ? i - 1 : 0, n};
+                else if (uplo == Uplo::Upper)
+                    return range{i, n};
+                else if (uplo == Uplo::StrictUpper)
+                    return range{i + 1, n};
+                else if (uplo == Uplo::LowerHessenberg)
+                    return range{0, min(i + 2, n)};
+                else if (uplo == Uplo::Lower)
+                    return range{0, min(i + 1, n)};
+                else if (uplo == Uplo::StrictLower)
+                    return range{0, min(i, n)};
+                else
+                    return range{0, n};
+            };
+
+            for (idx_t i = 0; i < m; ++i) {
+                const range r = rowRange(i);
+                if (any_in_range(
+                        pred, [&](idx_t j) { return A(i, j); }, r.first,
+                        r.second))
+                    return true;
+            }
+        }
+        else {
+            // Rows of column j that are accessed
+            auto colRange = [&](idx_t j) -> range {
+                if (uplo == Uplo::UpperHessenberg)
+                    return range{0, min(j + 2, m)};
+                else if (uplo == Uplo::Upper)
+                    return range{0, min(j + 1, m)};
+                else if (uplo == Uplo::StrictUpper)
+                    return range{0, min(j, m)};
+                else if (uplo == Uplo::LowerHessenberg)
+                    return range{(j > 0) ? j - 1 : 0, m};
+                else if (uplo == Uplo::Lower)
+                    return range{j, m};
+                else if (uplo == Uplo::StrictLower)
+                    return range{j + 1, m};
+                else
+                    return range{0, m};
+            };
+
+            for (idx_t j = 0; j < n; ++j) {
+                const range r = colRange(j);
+                if (any_in_range(
+                        pred, [&](idx_t i) { return A(i, j); }, r.first,
+                        r.second))
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    /** Returns true if pred(A(i,j)) is true for some entry in the band.
+     *
+     * @see any_entry(pred_t, Uplo, const matrix_t&)
+     *
+     * @ingroup auxiliary
+     */
+    template <class pred_t, class matrix_t>
+    bool any_entry(pred_t pred, BandAccess accessType, const matrix_t& A)
+    {
+        using idx_t = size_type<matrix_t>;
+
+        // constants
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t kl = accessType.lower_bandwidth;
+        const idx_t ku = accessType.upper_bandwidth;
+
+        if constexpr (layout<matrix_t> == Layout::RowMajor) {
+            for (idx_t i = 0; i < m; ++i)
+                if (any_in_range(
+                        pred, [&](idx_t j) { return A(i, j); },
+                        (i >= kl) ? (i - kl) : 0, min(n, i + ku + 1)))
+                    return true;
+        }
+        else {
+            for (idx_t j = 0; j < n; ++j)
+                if (any_in_range(
+                        pred, [&](idx_t i) { return A(i, j); },
+                        (j >= ku) ? (j - ku) : 0, min(m, j + kl + 1)))
+                    return true;
+        }
+        return false;
+    }
+
+}  // namespace internal
+
 /**
  * Returns true if and only if A has an NaN entry.
  *
+ * The entries are scanned in chunks, along the contiguous dimension of A,
+ * and the scan stops after the first chunk that contains a NaN.
+ *
  * @tparam uplo_t Type of access inside the algorithm.
  *      Either Uplo or any type that implements
  *          operator Uplo().
@@ -41,60 +180,15 @@ namespace tlapack {
 template <TLAPACK_UPLO uplo_t, TLAPACK_MATRIX matrix_t>
 bool hasnan(uplo_t uplo, const matrix_t& A)
 {
-    using idx_t = size_type<matrix_t>;
-
-    // constants
-    const idx_t m = nrows(A);
-    const idx_t n = ncols(A);
+    using T = type_t<matrix_t>;
 
     tlapack_check(uplo == Uplo::General || uplo == Uplo::UpperHessenberg ||
                   uplo == Uplo::LowerHessenberg || uplo == Uplo::Upper ||
                   uplo == Uplo::Lower || uplo == Uplo::StrictUpper ||
                   uplo == Uplo::StrictLower);
 
-    if (uplo == Uplo::UpperHessenberg) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < ((j < m) ? j + 2 : m); ++i)
-                if (isnan(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::Upper) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < ((j < m) ? j + 1 : m); ++i)
-                if (isnan(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::StrictUpper) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < ((j < m) ? j : m); ++i)
-                if (isnan(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::LowerHessenberg) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = ((j > 1) ? j - 1 : 0); i < m; ++i)
-                if (isnan(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::Lower) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = j; i < m; ++i)
-                if (isnan(A(i, j))) return true;
-        return false;
-    }
-    else if (uplo == Uplo::StrictLower) {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = j + 1; i < m; ++i)
-                if (isnan(A(i, j))) return true;
-        return false;
-    }
-    else  // if ( (Uplo) uplo == Uplo::General )
-    {
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < m; ++i)
-                if (isnan(A(i, j))) return true;
-        return false;
-    }
+    return internal::any_entry([](const T& x) { return isnan(x); },
+                               Uplo(uplo), A);
 }
 
 /**
@@ -108,18 +202,10 @@ bool hasnan(uplo_t uplo, const matrix_t& A)
 template <TLAPACK_MATRIX matrix_t>
 bool hasnan(BandAccess accessType, const matrix_t& A) noexcept
 {
-    using idx_t = size_type<matrix_t>;
-
-    // constants
-    const idx_t m = nrows(A);
-    const idx_t n = ncols(A);
-    const idx_t kl = accessType.lower_bandwidth;
-    const idx_t ku = accessType.upper_bandwidth;
-
-    for (idx_t j = 0; j < n; ++j)
-        for (idx_t i = ((j >= ku) ? (j - ku) : 0); i < min(m, j + kl + 1); ++i)
-            if (isnan(A(i, j))) return true;
-    return false;
+    using T = type_t<matrix_t>;
+
+    return internal::any_entry([](const T& x) { return isnan(x); },
+                               accessType, A);
 }
 
 /**
@@ -135,16 +221,14 @@ bool hasnan(BandAccess accessType, const matrix_t& A) noexcept
 template <TLAPACK_VECTOR vector_t>
 bool hasnan(const vector_t& x) noexcept
 {
+    using T = type_t<vector_t>;
     using idx_t = size_type<vector_t>;
 
-    // constants
-    const idx_t n = size(x);
-
-    for (idx_t i = 0; i < n; ++i)
-        if (isnan(x[i])) return true;
-    return false;
+    return internal::any_in_range([](const T& a) { return isnan(a); },
+                                  [&](idx_t i) { return x[i]; }, idx_t(0),
+                                  (idx_t)size(x));
 }
 
 }  // namespace tlapack
 
-#endif  // TLAPACK_HASNAN_HH
\ No newline at end of file
+#endif  // TLAPACK_HASNAN_HH
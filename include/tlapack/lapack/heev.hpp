@@ -0,0 +1,181 @@
+/// @file heev.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HEEV_HH
+#define TLAPACK_HEEV_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/hetrd.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/stebz.hpp"
+#include "tlapack/lapack/stedc.hpp"
+#include "tlapack/lapack/stein.hpp"
+#include "tlapack/lapack/steqr.hpp"
+#include "tlapack/lapack/unmtr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for heev
+ */
+struct HeevOpts {
+    EigenRange range = EigenRange::All;  ///< Which eigenvalues are computed
+    double vl = 0;  ///< Lower bound of the interval if range is Value
+    double vu = 0;  ///< Upper bound of the interval if range is Value
+    size_t il = 0;  ///< Index of the first eigenvalue if range is Index
+    size_t iu = 0;  ///< One past the last eigenvalue if range is Index
+
+    size_t nb = 32;          ///< Block size used in hetrd and unmtr
+    size_t nx_switch = 128;  ///< Crossover point of hetrd to unblocked code
+    size_t smlsiz = 25;      ///< Maximum size of the subproblems in stedc
+};
+
+/** Computes selected eigenvalues and, optionally, eigenvectors of a
+ * Hermitian matrix A.
+ *
+ * A is first reduced to real symmetric tridiagonal form T = Q**H A Q by
+ * hetrd(). Then,
+ *
+ * - if all eigenvalues and no eigenvectors are wanted, the eigenvalues of T
+ *   are computed by the implicit QL/QR method, steqr();
+ * - if all eigenvalues and eigenvectors are wanted, Q is formed with unmtr()
+ *   and the eigensystem of T is computed by the divide and conquer method,
+ *   stedc(), which updates Q to the eigenvectors of A;
+ * - if a subset of the eigenvalues is wanted, they are computed by bisection,
+ *   stebz(). The eigenvectors of T are then computed by inverse iteration,
+ *   stein(), and back-transformed with unmtr().
+ *
+ * @return  0 if success.
+ * @return  nonzero if the tridiagonal eigensolver failed to converge.
+ *
+ * @param[in] want_z bool
+ *      If true, the eigenvectors are computed.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, the referenced triangle of A is destroyed.
+ *
+ * @param[out] w Real vector of length n.
+ *      The first m entries contain the selected eigenvalues in ascending
+ *      order.
+ *
+ * @param[out] Z n-by-k matrix.
+ *      If want_z, the first m columns of Z contain the orthonormal
+ *      eigenvectors associated with the eigenvalues in w. k = n if
+ *      opts.range = EigenRange::All, and k >= m otherwise. If
+ *      opts.range = EigenRange::Index, m = opts.iu - opts.il.
+ *      Not referenced if want_z is false.
+ *
+ * @param[out] m integer.
+ *      The number of eigenvalues found.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.range selects all eigenvalues, the eigenvalues in the
+ *        interval (opts.vl, opts.vu], or the eigenvalues with indices
+ *        opts.il to opts.iu-1 in ascending order.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SVECTOR r_vector_t,
+          TLAPACK_SMATRIX matrixZ_t>
+int heev(bool want_z,
+         uplo_t uplo,
+         matrixA_t& A,
+         r_vector_t& w,
+         matrixZ_t& Z,
+         size_type<matrixA_t>& m,
+         const HeevOpts& opts = {})
+{
+    using idx_t = size_type<matrixA_t>;
+    using real_t = type_t<r_vector_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<vector_type<matrixA_t>> new_vector;
+    Create<vector_type<r_vector_t>> new_rvector;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = nrows(A);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(ncols(A) == n);
+    tlapack_check((idx_t)size(w) >= n);
+    tlapack_check(!want_z || nrows(Z) == n);
+    tlapack_check(!want_z || opts.range != EigenRange::All ||
+                  ncols(Z) == n);
+
+    // quick return
+    m = 0;
+    if (n == 0) return 0;
+
+    // Allocate vectors
+    std::vector<type_t<matrixA_t>> tau_;
+    auto tau = new_vector(tau_, max<idx_t>(1, n - 1));
+    std::vector<real_t> d_, e_;
+    auto d = new_rvector(d_, n);
+    auto e = new_rvector(e_, max<idx_t>(1, n - 1));
+
+    // Reduce A to tridiagonal form
+    HetrdOpts hetrdOpts;
+    hetrdOpts.nb = opts.nb;
+    hetrdOpts.nx_switch = opts.nx_switch;
+    hetrd(uplo, A, tau, hetrdOpts);
+
+    // Copy the tridiagonal matrix
+    for (idx_t i = 0; i < n; ++i)
+        d[i] = real(A(i, i));
+    for (idx_t i = 0; i + 1 < n; ++i)
+        e[i] = (uplo == Uplo::Upper) ? real(A(i, i + 1)) : real(A(i + 1, i));
+
+    const UnmtrOpts unmtrOpts{opts.nb};
+
+    if (opts.range == EigenRange::All) {
+        m = n;
+        for (idx_t i = 0; i < n; ++i)
+            w[i] = d[i];
+
+        if (!want_z) return steqr(false, w, e, Z);
+
+        // Form Q and compute the eigensystem of T
+        laset(GENERAL, zero, one, Z);
+        unmtr(LEFT_SIDE, uplo, NO_TRANS, A, tau, Z, unmtrOpts);
+
+        StedcOpts stedcOpts;
+        stedcOpts.smlsiz = opts.smlsiz;
+        return stedc(w, e, Z, stedcOpts);
+    }
+
+    // Selected eigenvalues by bisection
+    int info = stebz(opts.range, real_t(opts.vl), real_t(opts.vu),
+                     (idx_t)opts.il, (idx_t)opts.iu, d, e, w, m);
+
+    if (want_z && m > 0) {
+        tlapack_check(ncols(Z) >= m);
+
+        // Eigenvectors of T by inverse iteration, then back-transformation
+        auto wm = slice(w, range{0, m});
+        auto Zm = slice(Z, range{0, n}, range{0, m});
+        info += stein(d, e, wm, Zm);
+        unmtr(LEFT_SIDE, uplo, NO_TRANS, A, tau, Zm, unmtrOpts);
+    }
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HEEV_HH
@@ -27,14 +27,16 @@ namespace tlapack {
  *
  * @param[in,out] T n-by-n Upper triangular matrix.
  *
- * @param[in] cl Real vector of length n-1.
- *     Cosines of the left rotations
+ * @param[in] cl Vector of length n-1.
+ *     Cosines of the left rotations. The entries are real, but the vector
+ *     may have a complex type.
  *
  * @param[in] sl Vector of length n-1.
  *     Sines of the left rotations
  *
- * @param[out] cr Real vector of length n-1.
- *     Cosines of the right rotations
+ * @param[out] cr Vector of length n-1.
+ *     Cosines of the right rotations. The entries are real, but the vector
+ *     may have a complex type.
  *
  * @param[out] sr Vector of length n-1.
  *     Sines of the right rotations
@@ -51,6 +53,7 @@ inline void hessenberg_rq(T_t& T, CL_t& cl, SL_t& sl, CR_t& cr, SR_t& sr)
     using TA = type_t<T_t>;
     using idx_t = size_type<T_t>;
     using range = pair<idx_t, idx_t>;
+    using real_t = real_type<TA>;
 
     // constants
     const idx_t n = ncols(T);
@@ -76,14 +79,16 @@ inline void hessenberg_rq(T_t& T, CL_t& cl, SL_t& sl, CR_t& cr, SR_t& sr)
         }
 
         // Generate rotation to reduce T(i, i-1)
-        rotg(T(i, i), T(i, i - 1), cr[i - 1], sr[i - 1]);
+        real_t c;
+        rotg(T(i, i), T(i, i - 1), c, sr[i - 1]);
+        cr[i - 1] = c;
         sr[i - 1] = -sr[i - 1];
         T(i, i - 1) = (TA)0;
 
         // Apply rotation from the right
         auto t1 = slice(T, range(0, i), i - 1);
         auto t2 = slice(T, range(0, i), i);
-        rot(t1, t2, cr[i - 1], conj(sr[i - 1]));
+        rot(t1, t2, c, conj(sr[i - 1]));
     }
 }
 
@@ -0,0 +1,224 @@
+/// @file hetd2.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetd2.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HETD2_HH
+#define TLAPACK_HETD2_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/axpy.hpp"
+#include "tlapack/blas/dot.hpp"
+#include "tlapack/blas/hemv.hpp"
+#include "tlapack/blas/her2.hpp"
+#include "tlapack/lapack/larfg.hpp"
+
+namespace tlapack {
+
+/** Worspace query of hetd2()
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in] A n-by-n Hermitian matrix.
+ *
+ * @param tau Not referenced.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR vector_t>
+constexpr WorkInfo hetd2_worksize(uplo_t uplo,
+                                  const matrix_t& A,
+                                  const vector_t& tau)
+{
+    using work_t = matrix_type<matrix_t, vector_t>;
+
+    const size_t n = nrows(A);
+
+    if constexpr (is_same_v<T, type_t<work_t>>)
+        return (n > 1) ? WorkInfo(n - 1) : WorkInfo(0);
+    else
+        return WorkInfo(0);
+}
+
+/** @copybrief hetd2()
+ * Workspace is provided as an argument.
+ * @copydetails hetd2()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR vector_t,
+          TLAPACK_WORKSPACE work_t>
+int hetd2_work(uplo_t uplo, matrix_t& A, vector_t& tau, work_t& work)
+{
+    using TA = type_t<matrix_t>;
+    using real_t = real_type<TA>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t one(1);
+    const real_t zero(0);
+    const real_t half(0.5);
+    const idx_t n = nrows(A);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(ncols(A) == n);
+    tlapack_check((idx_t)size(tau) >= n - 1 || n == 0);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    // The diagonal of a Hermitian matrix is real
+    for (idx_t i = 0; i < n; ++i)
+        A(i, i) = real(A(i, i));
+
+    auto [w, work1] = reshape(work, n - 1);
+
+    if (uplo == Uplo::Upper) {
+        // Reduce the upper triangle of A, from the last column to the first
+        for (idx_t i = n - 1; i-- > 0;) {
+            // Generate elementary reflector H(i) to annihilate A(0:i, i+1)
+            auto v = slice(A, range{0, i + 1}, i + 1);
+            larfg(BACKWARD, COLUMNWISE_STORAGE, v, tau[i]);
+            const TA taui = tau[i];
+            const real_t e = real(A(i, i + 1));
+
+            if (taui != TA(0)) {
+                // Apply H(i) from both sides to A(0:i+1, 0:i+1)
+                A(i, i + 1) = one;
+                auto A11 = slice(A, range{0, i + 1}, range{0, i + 1});
+                auto x = slice(w, range{0, i + 1});
+
+                // x := tau * A11 * v
+                hemv(UPPER_TRIANGLE, taui, A11, v, zero, x);
+
+                // x := x - 1/2 * tau * (x**H * v) * v
+                const TA alpha = -half * taui * dot(x, v);
+                axpy(alpha, v, x);
+
+                // A11 := A11 - v * x**H - x * v**H
+                her2(UPPER_TRIANGLE, -one, v, x, A11);
+            }
+            A(i, i + 1) = e;
+        }
+    }
+    else {
+        // Reduce the lower triangle of A, from the first column to the last
+        for (idx_t i = 0; i < n - 1; ++i) {
+            // Generate elementary reflector H(i) to annihilate A(i+2:n, i)
+            auto v = slice(A, range{i + 1, n}, i);
+            larfg(FORWARD, COLUMNWISE_STORAGE, v, tau[i]);
+            const TA taui = tau[i];
+            const real_t e = real(A(i + 1, i));
+
+            if (taui != TA(0)) {
+                // Apply H(i) from both sides to A(i+1:n, i+1:n)
+                A(i + 1, i) = one;
+                auto A22 = slice(A, range{i + 1, n}, range{i + 1, n});
+                auto x = slice(w, range{i, n - 1});
+
+                // x := tau * A22 * v
+                hemv(LOWER_TRIANGLE, taui, A22, v, zero, x);
+
+                // x := x - 1/2 * tau * (x**H * v) * v
+                const TA alpha = -half * taui * dot(x, v);
+                axpy(alpha, v, x);
+
+                // A22 := A22 - v * x**H - x * v**H
+                her2(LOWER_TRIANGLE, -one, v, x, A22);
+            }
+            A(i + 1, i) = e;
+        }
+    }
+
+    return 0;
+}
+
+/** Reduces a Hermitian matrix A to real symmetric tridiagonal form T by a
+ * unitary similarity transformation:
+ * \[
+ *          Q**H * A * Q = T.
+ * \]
+ *
+ * If uplo = Uplo::Upper, the matrix Q is represented as a product of
+ * elementary reflectors
+ * \[
+ *          Q = H(n-2) . . . H(1) H(0).
+ * \]
+ * Each H(i) has the form
+ * \[
+ *          H(i) = I - tau * v * v**H
+ * \]
+ * where tau is a scalar, and v is a vector with v(i+1:n) = 0 and v(i) = 1;
+ * v(0:i) is stored on exit in A(0:i, i+1), and tau in tau[i].
+ *
+ * If uplo = Uplo::Lower, the matrix Q is represented as a product of
+ * elementary reflectors
+ * \[
+ *          Q = H(0) H(1) . . . H(n-2).
+ * \]
+ * Each H(i) has the form
+ * \[
+ *          H(i) = I - tau * v * v**H
+ * \]
+ * where tau is a scalar, and v is a vector with v(0:i+1) = 0 and v(i+1) = 1;
+ * v(i+2:n) is stored on exit in A(i+2:n, i), and tau in tau[i].
+ *
+ * @return  0 if success
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, the diagonal and the first superdiagonal (if uplo = Upper) or
+ *      subdiagonal (if uplo = Lower) are overwritten by the real tridiagonal
+ *      matrix T. The other elements of the referenced triangle, with the
+ *      array tau, represent the unitary matrix Q as a product of elementary
+ *      reflectors.
+ *
+ * @param[out] tau vector of length n-1.
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR vector_t>
+int hetd2(uplo_t uplo, matrix_t& A, vector_t& tau)
+{
+    using work_t = matrix_type<matrix_t, vector_t>;
+    using T = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = hetd2_worksize<T>(uplo, A, tau);
+    std::vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return hetd2_work(uplo, A, tau, work);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HETD2_HH
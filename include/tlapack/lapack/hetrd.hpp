@@ -0,0 +1,236 @@
+/// @file hetrd.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrd.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HETRD_HH
+#define TLAPACK_HETRD_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/her2k.hpp"
+#include "tlapack/lapack/hetd2.hpp"
+#include "tlapack/lapack/latrd.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for hetrd()
+ */
+struct HetrdOpts {
+    size_t nb = 32;          ///< Block size used in the blocked reduction
+    size_t nx_switch = 128;  ///< If only nx_switch columns are left, the
+                             ///< algorithm will use unblocked code
+};
+
+/** Worspace query of hetrd()
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in] A n-by-n Hermitian matrix.
+ *
+ * @param tau Not referenced.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR vector_t>
+constexpr WorkInfo hetrd_worksize(uplo_t uplo,
+                                  const matrix_t& A,
+                                  const vector_t& tau,
+                                  const HetrdOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using work_t = matrix_type<matrix_t, vector_t>;
+
+    // constants
+    const idx_t n = nrows(A);
+    const idx_t nb = min((idx_t)opts.nb, n);
+    const idx_t nx = max(nb, (idx_t)opts.nx_switch);
+
+    WorkInfo workinfo;
+    if constexpr (is_same_v<T, type_t<work_t>>)
+        if (nb > 0 && nx < n) workinfo = WorkInfo(n, nb);
+
+    workinfo += hetd2_worksize<T>(uplo, A, tau);
+
+    return workinfo;
+}
+
+/** @copybrief hetrd()
+ * Workspace is provided as an argument.
+ * @copydetails hetrd()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR vector_t,
+          TLAPACK_WORKSPACE work_t>
+int hetrd_work(uplo_t uplo,
+               matrix_t& A,
+               vector_t& tau,
+               work_t& work,
+               const HetrdOpts& opts = {})
+{
+    using TA = type_t<matrix_t>;
+    using real_t = real_type<TA>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+    const idx_t nb = min((idx_t)opts.nb, n);
+    const idx_t nx = max(nb, (idx_t)opts.nx_switch);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(ncols(A) == n);
+    tlapack_check((idx_t)size(tau) >= n - 1 || n == 0);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    // Use unblocked code for small matrices
+    if (nb <= 0 || nx >= n) return hetd2_work(uplo, A, tau, work);
+
+    // Matrix W
+    auto [W, work1] = reshape(work, n, nb);
+
+    if (uplo == Uplo::Upper) {
+        // Reduce the last columns of A in blocks of nb columns, leaving the
+        // leading kk-by-kk block to the unblocked code
+        const idx_t nblocks = (n - nx + nb - 1) / nb;
+        const idx_t kk = n - nblocks * nb;
+
+        for (idx_t i = n - nb; i + nb > kk; i -= nb) {
+            // Reduce columns i:i+nb to tridiagonal form and form the
+            // matrix W which is needed to update the unreduced part of A
+            auto A11 = slice(A, range{0, i + nb}, range{0, i + nb});
+            auto tau1 = slice(tau, range{0, i + nb - 1});
+            auto W1 = slice(W, range{0, i + nb}, range{0, nb});
+            latrd(uplo, A11, tau1, W1);
+
+            // Update the unreduced submatrix A(0:i, 0:i), using an update
+            // of the form  A := A - V*W**H - W*V**H
+            const TA e = A(i - 1, i);
+            A(i - 1, i) = one;
+
+            auto V = slice(A, range{0, i}, range{i, i + nb});
+            auto W0 = slice(W, range{0, i}, range{0, nb});
+            auto A00 = slice(A, range{0, i}, range{0, i});
+            her2k(UPPER_TRIANGLE, NO_TRANS, -one, V, W0, one, A00);
+
+            A(i - 1, i) = e;
+        }
+
+        // Use unblocked code to reduce the last or only block
+        auto A00 = slice(A, range{0, kk}, range{0, kk});
+        auto tau0 = slice(tau, range{0, kk - 1});
+        hetd2_work(uplo, A00, tau0, work1);
+    }
+    else {
+        // Reduce the first columns of A in blocks of nb columns, leaving the
+        // trailing block with at most nx columns to the unblocked code
+        idx_t i = 0;
+        for (; i + nx < n; i += nb) {
+            // Reduce columns i:i+nb to tridiagonal form and form the
+            // matrix W which is needed to update the unreduced part of A
+            auto A11 = slice(A, range{i, n}, range{i, n});
+            auto tau1 = slice(tau, range{i, n - 1});
+            auto W1 = slice(W, range{0, n - i}, range{0, nb});
+            latrd(uplo, A11, tau1, W1);
+
+            // Update the unreduced submatrix A(i+nb:n, i+nb:n), using an
+            // update of the form  A := A - V*W**H - W*V**H
+            const TA e = A(i + nb, i + nb - 1);
+            A(i + nb, i + nb - 1) = one;
+
+            auto V = slice(A, range{i + nb, n}, range{i, i + nb});
+            auto W2 = slice(W, range{nb, n - i}, range{0, nb});
+            auto A22 = slice(A, range{i + nb, n}, range{i + nb, n});
+            her2k(LOWER_TRIANGLE, NO_TRANS, -one, V, W2, one, A22);
+
+            A(i + nb, i + nb - 1) = e;
+        }
+
+        // Use unblocked code to reduce the last or only block
+        auto A22 = slice(A, range{i, n}, range{i, n});
+        auto tau2 = slice(tau, range{i, n - 1});
+        hetd2_work(uplo, A22, tau2, work1);
+    }
+
+    return 0;
+}
+
+/** Reduces a Hermitian matrix A to real symmetric tridiagonal form T by a
+ * unitary similarity transformation:
+ * \[
+ *          Q**H * A * Q = T.
+ * \]
+ *
+ * This is the blocked version of hetd2(). Blocks of nb columns are reduced
+ * by latrd(), and the remaining part of A is updated by a rank-2nb
+ * update with her2k(). See hetd2() for the representation of Q.
+ *
+ * @return  0 if success
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, the diagonal and the first superdiagonal (if uplo = Upper) or
+ *      subdiagonal (if uplo = Lower) are overwritten by the real tridiagonal
+ *      matrix T. The other elements of the referenced triangle, with the
+ *      array tau, represent the unitary matrix Q as a product of elementary
+ *      reflectors.
+ *
+ * @param[out] tau vector of length n-1.
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR vector_t>
+int hetrd(uplo_t uplo,
+          matrix_t& A,
+          vector_t& tau,
+          const HetrdOpts& opts = {})
+{
+    using work_t = matrix_type<matrix_t, vector_t>;
+    using T = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = hetrd_worksize<T>(uplo, A, tau, opts);
+    std::vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return hetrd_work(uplo, A, tau, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HETRD_HH
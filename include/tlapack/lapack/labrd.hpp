@@ -14,6 +14,7 @@
 
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/gemv2.hpp"
 #include "tlapack/blas/scal.hpp"
 #include "tlapack/lapack/conjugate.hpp"
 #include "tlapack/lapack/larfg.hpp"
@@ -75,14 +76,10 @@ int labrd(A_t& A, vector_t& tauq, vector_t& taup, X_t& X, matrixY_t& Y)
         //
         for (idx_t i = 0; i < nb; ++i) {
             // Update A(i:m,i)
+            // The update with A(i:m,0:i) * Y(i,0:i)^H was done in the
+            // previous step, together with the computation of X(i:m,i-1)
             if (i > 0) {
-                auto y = slice(Y, i, range{0, i});
-                auto A2 = slice(A, range{i, m}, range{0, i});
                 auto a21 = slice(A, range{i, m}, i);
-                conjugate(y);
-                gemv(NO_TRANS, -one, A2, y, one, a21);
-                conjugate(y);
-
                 auto X2 = slice(X, range{i, m}, range{0, i});
                 auto a22 = slice(A, range{0, i}, i);
                 real_t e = real(A(i - 1, i));
@@ -172,7 +169,18 @@ int labrd(A_t& A, vector_t& tauq, vector_t& taup, X_t& X, matrixY_t& Y)
                     gemv(CONJ_TRANS, one, Y4, w, zero, t2);
                     // x11 = x11 - A(i+1:m,0:i+1) * t
                     auto A5 = slice(A, range{i + 1, m}, range{0, i + 1});
-                    gemv(NO_TRANS, -one, A5, t2, one, x11);
+                    if (i + 1 < nb) {
+                        // Also A(i+1:m,i+1) -= A(i+1:m,0:i+1) * Y(i+1,0:i+1)^H
+                        // for the next step, reading A5 only once
+                        auto y = slice(Y, i + 1, range{0, i + 1});
+                        auto a21 = slice(A, range{i + 1, m}, i + 1);
+                        conjugate(y);
+                        gemv2(NO_TRANS, NO_TRANS, -one, A5, t2, y, one, x11,
+                              a21);
+                        conjugate(y);
+                    }
+                    else
+                        gemv(NO_TRANS, -one, A5, t2, one, x11);
                     // t = A(0:i,i+1:n) * w
                     auto A6 = slice(A, range{0, i}, range{i + 1, n});
                     auto t3 = slice(X, range{0, i}, i);
@@ -237,9 +245,15 @@ int labrd(A_t& A, vector_t& tauq, vector_t& taup, X_t& X, matrixY_t& Y)
                         auto Y4 = slice(Y, range{i, n}, range{0, i});
                         auto t2 = slice(X, range{0, i}, i);
                         gemv(CONJ_TRANS, one, Y4, w, zero, t2);
-                        // x11 = x11 - A(i+1:m,0:i) * t
+                        // x11 = x11 - A(i+1:m,0:i) * t and
+                        // A(i+1:m,i) -= A(i+1:m,0:i) * Y(i,0:i)^H
                         auto A5 = slice(A, range{i + 1, m}, range{0, i});
-                        gemv(NO_TRANS, -one, A5, t2, one, x11);
+                        auto y = slice(Y, i, range{0, i});
+                        auto a21 = slice(A, range{i + 1, m}, i);
+                        conjugate(y);
+                        gemv2(NO_TRANS, NO_TRANS, -one, A5, t2, y, one, x11,
+                              a21);
+                        conjugate(y);
                         // t = A(0:i,i:n) * w
                         auto A6 = slice(A, range{0, i}, range{i, n});
                         auto t3 = slice(X, range{0, i}, i);
@@ -254,14 +268,10 @@ int labrd(A_t& A, vector_t& tauq, vector_t& taup, X_t& X, matrixY_t& Y)
                 }
 
                 // Update A(i+1:m,i)
+                // The update with A(i+1:m,0:i) * Y(i,0:i)^H was done together
+                // with the computation of X(i+1:m,i)
                 {
-                    auto y = slice(Y, i, range{0, i});
-                    auto A2 = slice(A, range{i + 1, m}, range{0, i});
                     auto a21 = slice(A, range{i + 1, m}, i);
-                    conjugate(y);
-                    gemv(NO_TRANS, -one, A2, y, one, a21);
-                    conjugate(y);
-
                     auto X2 = slice(X, range{i + 1, m}, range{0, i + 1});
                     auto a22 = slice(A, range{0, i + 1}, i);
                     gemv(NO_TRANS, -one, X2, a22, one, a21);
@@ -12,13 +12,93 @@
 #ifndef TLAPACK_LACPY_HH
 #define TLAPACK_LACPY_HH
 
-#include "tlapack/base/types.hpp"
+#include "tlapack/base/utils.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /// Minimum number of entries for which entrywise kernels use threads
+    constexpr std::size_t entrywise_parallel_min = 65536;
+
+    /** Calls f(i,j) for all entries (i,j) of an m-by-n matrix in uplo.
+     *
+     * The outer loop runs over the columns, or over the rows if rowMajor is
+     * true, so that the inner loop runs over contiguous memory and can be
+     * vectorized. When TLAPACK_USE_OPENMP is defined, the outer loop of large
+     * matrices is split among threads. f must be safe to call concurrently
+     * for different entries.
+     *
+     * @param[in] uplo
+     *      One of Uplo::General, Uplo::UpperHessenberg,
+     *      Uplo::LowerHessenberg, Uplo::Upper, Uplo::Lower, Uplo::StrictUpper
+     *      or Uplo::StrictLower.
+     *
+     * @ingroup auxiliary
+     */
+    template <bool rowMajor, class idx_t, class func_t>
+    void for_each_entry(Uplo uplo, idx_t m, idx_t n, func_t f)
+    {
+        // Inner loop bounds
+        const idx_t nOuter = rowMajor ? m : n;
+        const idx_t nInner = rowMajor ? n : m;
+        auto innerBegin = [&](idx_t k) -> idx_t {
+            const Uplo lo = rowMajor ? Uplo::Upper : Uplo::Lower;
+            const Uplo strictLo =
+                rowMajor ? Uplo::StrictUpper : Uplo::StrictLower;
+            const Uplo hessLo =
+                rowMajor ? Uplo::UpperHessenberg : Uplo::LowerHessenberg;
+            if (uplo == lo)
+                return min(k, nInner);
+            else if (uplo == strictLo)
+                return min(k + 1, nInner);
+            else if (uplo == hessLo)
+                return min((k > 0) ? k - 1 : 0, nInner);
+            else
+                return 0;
+        };
+        auto innerEnd = [&](idx_t k) -> idx_t {
+            const Uplo hi = rowMajor ? Uplo::Lower : Uplo::Upper;
+            const Uplo strictHi =
+                rowMajor ? Uplo::StrictLower : Uplo::StrictUpper;
+            const Uplo hessHi =
+                rowMajor ? Uplo::LowerHessenberg : Uplo::UpperHessenberg;
+            if (uplo == hi)
+                return min(k + 1, nInner);
+            else if (uplo == strictHi)
+                return min(k, nInner);
+            else if (uplo == hessHi)
+                return min(k + 2, nInner);
+            else
+                return nInner;
+        };
+
+#ifdef TLAPACK_USE_OPENMP
+        const bool parallel =
+            (std::size_t)m * (std::size_t)n >= entrywise_parallel_min;
+#pragma omp parallel for schedule(static, 8) if (parallel)
+#endif
+        for (idx_t k = 0; k < nOuter; ++k) {
+            const idx_t l1 = innerEnd(k);
+            if constexpr (rowMajor) {
+                for (idx_t l = innerBegin(k); l < l1; ++l)
+                    f(k, l);
+            }
+            else {
+                for (idx_t l = innerBegin(k); l < l1; ++l)
+                    f(l, k);
+            }
+        }
+    }
+
+}  // namespace internal
+
 /**
  * @brief Copies a matrix from A to B.
  *
+ * The entries are copied along the contiguous dimension of B. Large matrices
+ * are copied in parallel when TLAPACK_USE_OPENMP is defined.
+ *
  * @tparam uplo_t Either Uplo or any class that implements `operator Uplo()`.
  *
  * @param[in] uplo
@@ -48,27 +128,8 @@ void lacpy(uplo_t uplo, const matrixA_t& A, matrixB_t& B)
     tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper &&
                         uplo != Uplo::General);
 
-    if (uplo == Uplo::Upper) {
-        // Set the strictly upper triangular or trapezoidal part of B
-        for (idx_t j = 0; j < n; ++j) {
-            const idx_t M = min(m, j + 1);
-            for (idx_t i = 0; i < M; ++i)
-                B(i, j) = A(i, j);
-        }
-    }
-    else if (uplo == Uplo::Lower) {
-        // Set the strictly lower triangular or trapezoidal part of B
-        const idx_t N = min(m, n);
-        for (idx_t j = 0; j < N; ++j)
-            for (idx_t i = j; i < m; ++i)
-                B(i, j) = A(i, j);
-    }
-    else {
-        // Set the whole m-by-n matrix B
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < m; ++i)
-                B(i, j) = A(i, j);
-    }
+    internal::for_each_entry<layout<matrixB_t> == Layout::RowMajor>(
+        Uplo(uplo), m, n, [&](idx_t i, idx_t j) { B(i, j) = A(i, j); });
 }
 
 }  // namespace tlapack
@@ -0,0 +1,403 @@
+/// @file laed1.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed1.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LAED1_HH
+#define TLAPACK_LAED1_HH
+
+#include <algorithm>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/laed4.hpp"
+#include "tlapack/lapack/lapy2.hpp"
+
+namespace tlapack {
+
+/** Worksize for laed1()
+ *
+ * @tparam T Type of the entries of the workspace.
+ *
+ * @param[in] d Real vector of length n.
+ * @param[in] Q n-by-n matrix.
+ * @param[in] cutpnt integer, 0 < cutpnt < n.
+ * @param[in] beta real.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SVECTOR d_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_REAL real_t>
+constexpr WorkInfo laed1_worksize(const d_t& d,
+                                  const matrix_t& Q,
+                                  size_type<d_t> cutpnt,
+                                  const real_t& beta)
+{
+    using idx_t = size_type<d_t>;
+    const idx_t n = size(d);
+
+    // Sorted eigenvectors Qs, the nonzero blocks of the nondeflated
+    // eigenvectors and the eigenvectors U of the rank-one modification
+    return WorkInfo(3 * n * n);
+}
+
+/** @copybrief laed1()
+ * Workspace is provided as an argument.
+ * @copydetails laed1()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SVECTOR d_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_REAL real_t,
+          TLAPACK_WORKSPACE work_t>
+int laed1_work(d_t& d,
+               matrix_t& Q,
+               size_type<d_t> cutpnt,
+               const real_t& beta,
+               work_t& work)
+{
+    using idx_t = size_type<d_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<vector_type<d_t>> new_vector;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t two(2);
+    const real_t eight(8);
+    const real_t eps = ulp<real_t>();
+    const idx_t n = size(d);
+    const idx_t n1 = cutpnt;
+    const idx_t n2 = n - n1;
+
+    // check arguments
+    tlapack_check(0 < cutpnt && cutpnt < n);
+    tlapack_check(nrows(Q) == n && ncols(Q) == n);
+
+    // Form the updating vector z = Q**T * u / sqrt(2), where ||z|| = 1
+    std::vector<real_t> z(n);
+    {
+        const real_t s = one / sqrt(two);
+        for (idx_t j = 0; j < n1; ++j)
+            z[j] = s * real(Q(n1 - 1, j));
+        for (idx_t j = n1; j < n; ++j)
+            z[j] = (beta < zero) ? -s * real(Q(n1, j)) : s * real(Q(n1, j));
+    }
+    const real_t rho = two * abs(beta);
+
+    // Sort the eigenvalues in ascending order by merging the two lists
+    std::vector<idx_t> perm(n);
+    for (idx_t i = 0, i1 = 0, i2 = n1; i < n; ++i) {
+        if (i2 == n || (i1 < n1 && d[i1] <= d[i2]))
+            perm[i] = i1++;
+        else
+            perm[i] = i2++;
+    }
+
+    // Column types of the sorted eigenvectors: 1 if the column is only
+    // nonzero in the rows 0:n1, 3 if it is only nonzero in the rows n1:n, and
+    // 2 if it is nonzero in both blocks after a deflation rotation
+    std::vector<int> coltyp(n);
+
+    std::vector<real_t> ds_(n), zs(n);
+    auto ds = new_vector(ds_, n);
+    auto [Qs, work1] = reshape(work, n, n);
+    for (idx_t i = 0; i < n; ++i) {
+        ds[i] = d[perm[i]];
+        zs[i] = z[perm[i]];
+        coltyp[i] = (perm[i] < n1) ? 1 : 3;
+        for (idx_t j = 0; j < n; ++j)
+            Qs(j, i) = Q(j, perm[i]);
+    }
+
+    // Deflation tolerance
+    real_t dmax(0), zmax(0);
+    for (idx_t i = 0; i < n; ++i) {
+        dmax = max(dmax, abs(ds[i]));
+        zmax = max(zmax, abs(zs[i]));
+    }
+    const real_t tol = eight * eps * max(dmax, zmax);
+
+    // Split the eigenvalues into the nondeflated and the deflated ones
+    std::vector<idx_t> nondefl, defl;
+    if (rho * zmax > tol) {
+        idx_t prev = n;  // Last nondeflated candidate
+        for (idx_t j = 0; j < n; ++j) {
+            if (rho * abs(zs[j]) <= tol) {
+                // Deflate due to small z component
+                defl.push_back(j);
+                continue;
+            }
+            if (prev == n) {
+                prev = j;
+                continue;
+            }
+
+            // Check if eigenvalues are close enough to allow deflation
+            real_t s = zs[prev];
+            real_t c = zs[j];
+            const real_t tau = lapy2(c, s);
+            const real_t t = ds[j] - ds[prev];
+            c = c / tau;
+            s = -s / tau;
+            if (abs(t * c * s) <= tol) {
+                // Deflation is possible
+                zs[j] = tau;
+                zs[prev] = zero;
+                auto q1 = slice(Qs, range{0, n}, prev);
+                auto q2 = slice(Qs, range{0, n}, j);
+                rot(q1, q2, c, s);
+                if (coltyp[prev] != coltyp[j]) coltyp[j] = 2;
+                const real_t temp = ds[prev] * c * c + ds[j] * s * s;
+                ds[j] = ds[prev] * s * s + ds[j] * c * c;
+                ds[prev] = temp;
+                defl.push_back(prev);
+            }
+            else {
+                nondefl.push_back(prev);
+            }
+            prev = j;
+        }
+        if (prev < n) nondefl.push_back(prev);
+    }
+    else {
+        // All eigenvalues are deflated
+        for (idx_t j = 0; j < n; ++j)
+            defl.push_back(j);
+    }
+    const idx_t k = nondefl.size();
+
+    // Eigenvalues of the merged problem, in the order nondeflated, deflated
+    std::vector<real_t> lambda(n);
+    for (idx_t p = 0; p < n - k; ++p)
+        lambda[k + p] = ds[defl[p]];
+
+    // Sorts the eigenvalues in ascending order. dest[p] is the position of the
+    // eigenpair p of the merged problem in the output.
+    std::vector<idx_t> dest(n);
+    auto sort_eigenvalues = [&]() {
+        for (idx_t i = 0; i < n; ++i)
+            perm[i] = i;
+        std::sort(perm.begin(), perm.end(), [&lambda](idx_t a, idx_t b) {
+            return lambda[a] < lambda[b];
+        });
+        for (idx_t i = 0; i < n; ++i) {
+            d[i] = lambda[perm[i]];
+            dest[perm[i]] = i;
+        }
+    };
+
+    int info = 0;
+    if (k > 0) {
+        // Position of each nondeflated eigenvector when they are grouped by
+        // column type
+        idx_t k1 = 0, k2 = 0;
+        for (idx_t p = 0; p < k; ++p) {
+            if (coltyp[nondefl[p]] == 1)
+                ++k1;
+            else if (coltyp[nondefl[p]] == 2)
+                ++k2;
+        }
+        const idx_t k3 = k - k1 - k2;
+        std::vector<idx_t> pos(k);
+        for (idx_t p = 0, p1 = 0, p2 = k1, p3 = k1 + k2; p < k; ++p) {
+            const int t = coltyp[nondefl[p]];
+            pos[p] = (t == 1) ? p1++ : (t == 2) ? p2++ : p3++;
+        }
+
+        // Nonzero blocks of the grouped nondeflated eigenvectors:
+        // Q1k = Qs(0:n1, types 1 and 2) and Q2k = Qs(n1:n, types 2 and 3)
+        auto [Q1k, work2] = reshape(work1, n1, k1 + k2);
+        auto [Q2k, work3] = reshape(work2, n2, k2 + k3);
+        for (idx_t p = 0; p < k; ++p) {
+            if (pos[p] < k1 + k2)
+                for (idx_t i = 0; i < n1; ++i)
+                    Q1k(i, pos[p]) = Qs(i, nondefl[p]);
+            if (pos[p] >= k1)
+                for (idx_t i = 0; i < n2; ++i)
+                    Q2k(i, pos[p] - k1) = Qs(n1 + i, nondefl[p]);
+        }
+
+        std::vector<real_t> dk_(k), zk_(k), zhat(k);
+        auto dk = new_vector(dk_, k);
+        auto zk = new_vector(zk_, k);
+        for (idx_t p = 0; p < k; ++p) {
+            dk[p] = ds[nondefl[p]];
+            zk[p] = zs[nondefl[p]];
+        }
+
+        // Solve the secular equation. Column p of U contains the differences
+        // dk[i] - lambda[p]
+        auto [U, work4] = reshape(work3, k, k);
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (idx_t p = 0; p < k; ++p) {
+            auto delta = slice(U, range{0, k}, p);
+            if (laed4(p, dk, zk, delta, rho, lambda[p]) != 0) {
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp critical
+#endif
+                info = (info == 0) ? int(p) + 1 : info;
+            }
+        }
+        sort_eigenvalues();
+
+        // Compute the updating vector zhat that corresponds exactly to the
+        // computed eigenvalues
+        for (idx_t i = 0; i < k; ++i) {
+            real_t w = U(i, i);
+            for (idx_t j = 0; j < k; ++j)
+                if (j != i) w *= U(i, j) / (dk[i] - dk[j]);
+            zhat[i] = (zk[i] < zero) ? -sqrt(abs(w)) : sqrt(abs(w));
+        }
+
+        // Compute the normalized eigenvectors of the rank-one modification
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (idx_t p = 0; p < k; ++p) {
+            real_t nrm(0);
+            for (idx_t i = 0; i < k; ++i) {
+                const real_t ui = zhat[i] / U(i, p);
+                U(i, p) = ui;
+                nrm += ui * ui;
+            }
+            nrm = sqrt(nrm);
+            for (idx_t i = 0; i < k; ++i)
+                U(i, p) /= nrm;
+        }
+
+        // Group the rows of U by column type, as the columns of Q1k and Q2k,
+        // with row swaps. at[p] is the current row of the original row p, and
+        // row[i] is the original row currently stored in the row i.
+        std::vector<idx_t> row(k), at(k);
+        for (idx_t p = 0; p < k; ++p)
+            row[p] = at[p] = p;
+        for (idx_t p = 0; p < k; ++p) {
+            const idx_t i = at[p];
+            if (i != pos[p]) {
+                auto u1 = slice(U, pos[p], range{0, k});
+                auto u2 = slice(U, i, range{0, k});
+                tlapack::swap(u1, u2);
+                const idx_t q = row[pos[p]];
+                at[q] = i;
+                row[i] = q;
+                at[p] = pos[p];
+                row[pos[p]] = p;
+            }
+        }
+
+        // Back-transform the eigenvectors using the block structure of Qs:
+        // R(0:n1, :) = Q1k * U(0:k1+k2, :) and R(n1:n, :) = Q2k * U(k1:k, :).
+        // R overwrites Qs, so the deflated eigenvectors are copied to Q first.
+        for (idx_t p = 0; p < n - k; ++p)
+            for (idx_t i = 0; i < n; ++i)
+                Q(i, dest[k + p]) = Qs(i, defl[p]);
+        auto R1 = slice(Qs, range{0, n1}, range{0, k});
+        auto R2 = slice(Qs, range{n1, n}, range{0, k});
+        gemm(NO_TRANS, NO_TRANS, one, Q1k, rows(U, range{0, k1 + k2}), R1);
+        gemm(NO_TRANS, NO_TRANS, one, Q2k, rows(U, range{k1, k}), R2);
+        for (idx_t p = 0; p < k; ++p)
+            for (idx_t i = 0; i < n; ++i)
+                Q(i, dest[p]) = Qs(i, p);
+    }
+    else {
+        // All eigenpairs are deflated and are copied without modification
+        sort_eigenvalues();
+        for (idx_t p = 0; p < n; ++p)
+            for (idx_t i = 0; i < n; ++i)
+                Q(i, dest[p]) = Qs(i, defl[p]);
+    }
+
+    return info;
+}
+
+/** Computes the updated eigensystem of a diagonal matrix after modification
+ * by a symmetric rank-one matrix. This is the merge step of the divide and
+ * conquer method in stedc().
+ *
+ * Let T be the symmetric tridiagonal matrix with the off-diagonal element
+ * beta at position (cutpnt, cutpnt-1), and let T1 and T2 be its leading
+ * cutpnt-by-cutpnt and trailing diagonal blocks, with |beta| subtracted from
+ * their last and first diagonal element respectively. Then
+ * \[
+ *          T = diag(T1, T2) + |beta| * u * u**T,
+ * \]
+ * where u has the entries 1 and sign(beta) at positions cutpnt-1 and cutpnt.
+ * Given the eigendecompositions of T1 and T2, this routine computes the
+ * eigendecomposition of T in three steps:
+ *
+ * 1. Deflation of the eigenvalues that are either already eigenvalues of T,
+ *    because the corresponding component of the updating vector is
+ *    negligible, or that are close to another eigenvalue. In the latter case,
+ *    a plane rotation is applied to the eigenvectors.
+ *
+ * 2. The remaining eigenvalues are computed by solving the secular equation
+ *    with laed4().
+ *
+ * 3. The eigenvectors are computed with the updating vector recomputed from
+ *    the computed eigenvalues, as proposed by Gu and Eisenstat, so that they
+ *    are numerically orthogonal. They are then multiplied by the eigenvectors
+ *    of T1 and T2 with gemm(). As in LAPACK's dlaed3, the eigenvectors of T1
+ *    and T2 are grouped by their nonzero structure, so that the product only
+ *    involves the nonzero blocks of diag(Q1, Q2).
+ *
+ * The secular equations are solved in parallel when <T>LAPACK is built with
+ * TLAPACK_USE_OPENMP.
+ *
+ * @return 0 if success.
+ * @return i+1 if the i-th root of the secular equation did not converge.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, d[0:cutpnt] and d[cutpnt:n] contain the eigenvalues of T1
+ *      and T2, each in ascending order.
+ *      On exit, the eigenvalues of T in ascending order.
+ *
+ * @param[in,out] Q n-by-n matrix with real entries.
+ *      On entry, Q = diag(Q1, Q2), where Q1 and Q2 are the eigenvectors of
+ *      T1 and T2.
+ *      On exit, the eigenvectors of T.
+ *
+ * @param[in] cutpnt integer, 0 < cutpnt < n.
+ *      Size of the leading block T1.
+ *
+ * @param[in] beta real.
+ *      The off-diagonal element of T that couples T1 and T2.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SVECTOR d_t, TLAPACK_SMATRIX matrix_t, TLAPACK_REAL real_t>
+int laed1(d_t& d, matrix_t& Q, size_type<d_t> cutpnt, const real_t& beta)
+{
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = laed1_worksize<real_t>(d, Q, cutpnt, beta);
+    std::vector<real_t> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return laed1_work(d, Q, cutpnt, beta, work);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LAED1_HH
@@ -0,0 +1,225 @@
+/// @file laed4.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed4.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LAED4_HH
+#define TLAPACK_LAED4_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/** Computes the i-th eigenvalue of a symmetric rank-one modification of a
+ * diagonal matrix
+ * \[
+ *          D + rho * z * z**T,
+ * \]
+ * i.e., the i-th root, in ascending order, of the secular equation
+ * \[
+ *          f(lambda) = 1/rho + sum_j z(j)**2 / (d(j) - lambda) = 0.
+ * \]
+ *
+ * The root lies in the interval (d(i), d(i+1)), or in (d(k-1), d(k-1) +
+ * rho * z**T z] for the last root. The iteration is carried out on the
+ * distance tau between the root and the closest pole, so that the
+ * differences d(j) - lambda are computed to high relative accuracy. Each
+ * step solves a rational model that interpolates f at the two poles
+ * adjacent to the root. Steps that leave the current bracket of the root
+ * are replaced by bisection.
+ *
+ * @return 0 if success.
+ * @return 1 if the iteration did not converge.
+ *
+ * @param[in] i integer, 0 <= i < k.
+ *      The index of the eigenvalue to be computed.
+ *
+ * @param[in] d Real vector of length k.
+ *      The original eigenvalues. They must be in strictly increasing order.
+ *
+ * @param[in] z Real vector of length k.
+ *      The components of the updating vector. No component may be zero.
+ *
+ * @param[out] delta Real vector of length k.
+ *      delta[j] = d[j] - lambda, computed with high relative accuracy. These
+ *      are used to compute the eigenvectors of the modified matrix.
+ *
+ * @param[in] rho real.
+ *      The scalar in the symmetric updating formula. rho > 0.
+ *
+ * @param[out] lambda real.
+ *      The computed eigenvalue.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SVECTOR d_t,
+          TLAPACK_SVECTOR z_t,
+          TLAPACK_SVECTOR delta_t,
+          TLAPACK_REAL real_t>
+int laed4(size_type<d_t> i,
+          const d_t& d,
+          const z_t& z,
+          delta_t& delta,
+          const real_t& rho,
+          real_t& lambda)
+{
+    using idx_t = size_type<d_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t two(2);
+    const real_t three(3);
+    const real_t four(4);
+    const real_t eight(8);
+    const real_t eps = ulp<real_t>();
+    const idx_t k = size(d);
+    const idx_t maxit = 100;
+
+    // check arguments
+    tlapack_check(i < k);
+    tlapack_check((idx_t)size(z) == k && (idx_t)size(delta) >= k);
+    tlapack_check(rho > zero);
+
+    const real_t rhoinv = one / rho;
+
+    // Quick return
+    if (k == 1) {
+        lambda = d[0] + rho * z[0] * z[0];
+        delta[0] = -rho * z[0] * z[0];
+        return 0;
+    }
+
+    // The rational model interpolates f at the poles p and p+1
+    const idx_t p = (i < k - 1) ? i : k - 2;
+
+    // Evaluates f at tau, relative to the origin d[io]. Sets the parts of f
+    // and of its derivative from the poles 0:p+1 (psi) and p+1:k (phi), and
+    // a bound for the rounding error in w = f(tau)
+    real_t psi, dpsi, phi, dphi, erretm;
+    auto eval = [&](idx_t io, real_t tau) {
+        psi = dpsi = phi = dphi = erretm = zero;
+        for (idx_t j = 0; j < k; ++j) {
+            delta[j] = (d[j] - d[io]) - tau;
+            const real_t temp = z[j] / delta[j];
+            if (j <= p) {
+                psi += z[j] * temp;
+                dpsi += temp * temp;
+            }
+            else {
+                phi += z[j] * temp;
+                dphi += temp * temp;
+            }
+            erretm += abs(z[j] * temp);
+        }
+        erretm = eight * erretm + two * rhoinv +
+                 three * abs(tau) * (dpsi + dphi);
+        return rhoinv + psi + phi;
+    };
+
+    // Choose the origin and the initial bracket [lo, hi] for tau
+    idx_t io;
+    real_t lo, hi;
+    if (i < k - 1) {
+        const real_t mid = (d[i + 1] - d[i]) / two;
+        if (eval(i, mid) > zero) {
+            // The root is closer to d[i]
+            io = i;
+            lo = zero;
+            hi = mid;
+        }
+        else {
+            // The root is closer to d[i+1]
+            io = i + 1;
+            lo = -mid;
+            hi = zero;
+        }
+    }
+    else {
+        real_t zz = zero;
+        for (idx_t j = 0; j < k; ++j)
+            zz += z[j] * z[j];
+        io = k - 1;
+        lo = zero;
+        hi = rho * zz;
+    }
+
+    // Initial guess
+    real_t tau = (lo + hi) / two;
+
+    int info = 1;
+    for (idx_t iter = 0; iter < maxit; ++iter) {
+        const real_t w = eval(io, tau);
+
+        // Test for convergence
+        if (abs(w) <= eps * erretm) {
+            info = 0;
+            break;
+        }
+
+        // Update the bracket of the root. f is increasing between the poles
+        if (w < zero)
+            lo = tau;
+        else
+            hi = tau;
+
+        if (hi - lo <= two * eps * max(abs(lo), abs(hi))) {
+            info = 0;
+            break;
+        }
+
+        // Solve the rational model
+        //     c + dpsi * del_p**2 / (del_p - eta) + dphi * del_q**2 /
+        //     (del_q - eta) = 0,
+        // where del_p = delta[p] and del_q = delta[p+1]
+        const real_t dp = delta[p];
+        const real_t dq = delta[p + 1];
+        real_t c = w - dp * dpsi - dq * dphi;
+        const real_t a = (dp + dq) * w - dp * dq * (dpsi + dphi);
+        const real_t b = dp * dq * w;
+
+        real_t eta;
+        if (i < k - 1) {
+            if (c == zero)
+                eta = b / a;
+            else if (a <= zero)
+                eta = (a - sqrt(abs(a * a - four * b * c))) / (two * c);
+            else
+                eta = two * b / (a + sqrt(abs(a * a - four * b * c)));
+        }
+        else {
+            if (c < zero) c = abs(c);
+            if (c == zero)
+                eta = b / a;
+            else if (a >= zero)
+                eta = (a + sqrt(abs(a * a - four * b * c))) / (two * c);
+            else
+                eta = two * b / (a - sqrt(abs(a * a - four * b * c)));
+        }
+
+        // Take a Newton step if eta points to the wrong direction
+        if (w * eta >= zero) eta = -w / (dpsi + dphi);
+
+        // Bisect if the step leaves the bracket
+        const real_t next = tau + eta;
+        if (!(next > lo && next < hi)) eta = (lo + hi) / two - tau;
+
+        tau += eta;
+    }
+
+    for (idx_t j = 0; j < k; ++j)
+        delta[j] = (d[j] - d[io]) - tau;
+    lambda = d[io] + tau;
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LAED4_HH
@@ -0,0 +1,125 @@
+/// @file laev2.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaev2.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LAEV2_HH
+#define TLAPACK_LAEV2_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/** Computes the eigendecomposition of a 2x2 real symmetric matrix
+ * \[
+ *          [ a b ]
+ *          [ b c ].
+ * \]
+ * On return, rt1 is the eigenvalue of larger absolute value, rt2 is the
+ * eigenvalue of smaller absolute value, and (cs1, sn1) is the unit right
+ * eigenvector for rt1, giving the decomposition
+ * \[
+ *          [  cs1 sn1 ] [ a b ] [ cs1 -sn1 ]  =  [ rt1  0  ]
+ *          [ -sn1 cs1 ] [ b c ] [ sn1  cs1 ]     [  0  rt2 ].
+ * \]
+ *
+ * @param[in] a Element (0,0) of the matrix.
+ * @param[in] b Element (0,1) and (1,0) of the matrix.
+ * @param[in] c Element (1,1) of the matrix.
+ * @param[out] rt1 The eigenvalue of larger absolute value.
+ * @param[out] rt2 The eigenvalue of smaller absolute value.
+ * @param[out] cs1
+ * @param[out] sn1
+ *      The vector (cs1, sn1) is a unit right eigenvector for rt1.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_REAL T>
+void laev2(const T& a, const T& b, const T& c, T& rt1, T& rt2, T& cs1, T& sn1)
+{
+    // Constants
+    const T zero(0);
+    const T one(1);
+    const T two(2);
+    const T half(0.5);
+
+    const T sm = a + c;
+    const T df = a - c;
+    const T adf = abs(df);
+    const T tb = b + b;
+    const T ab = abs(tb);
+    const T acmx = (abs(a) > abs(c)) ? a : c;
+    const T acmn = (abs(a) > abs(c)) ? c : a;
+
+    T rt;
+    if (adf > ab)
+        rt = adf * sqrt(one + square(ab / adf));
+    else if (adf < ab)
+        rt = ab * sqrt(one + square(adf / ab));
+    else
+        rt = ab * sqrt(two);  // Includes case ab = adf = 0
+
+    int sgn1;
+    if (sm < zero) {
+        rt1 = half * (sm - rt);
+        sgn1 = -1;
+        // Order of execution important.
+        // To get fully accurate smaller eigenvalue,
+        // next line needs to be executed in higher precision.
+        rt2 = (acmx / rt1) * acmn - (b / rt1) * b;
+    }
+    else if (sm > zero) {
+        rt1 = half * (sm + rt);
+        sgn1 = 1;
+        rt2 = (acmx / rt1) * acmn - (b / rt1) * b;
+    }
+    else {
+        // Includes case rt1 = rt2 = 0
+        rt1 = half * rt;
+        rt2 = -half * rt;
+        sgn1 = 1;
+    }
+
+    // Compute the eigenvector
+    int sgn2;
+    T cs;
+    if (df >= zero) {
+        cs = df + rt;
+        sgn2 = 1;
+    }
+    else {
+        cs = df - rt;
+        sgn2 = -1;
+    }
+    if (abs(cs) > ab) {
+        const T ct = -tb / cs;
+        sn1 = one / sqrt(one + ct * ct);
+        cs1 = ct * sn1;
+    }
+    else {
+        if (ab == zero) {
+            cs1 = one;
+            sn1 = zero;
+        }
+        else {
+            const T tn = -cs / tb;
+            cs1 = one / sqrt(one + tn * tn);
+            sn1 = tn * cs1;
+        }
+    }
+    if (sgn1 == sgn2) {
+        const T tn = cs1;
+        cs1 = -sn1;
+        sn1 = tn;
+    }
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LAEV2_HH
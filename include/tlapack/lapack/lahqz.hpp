@@ -20,6 +20,7 @@
 #include "tlapack/lapack/inv_house3.hpp"
 #include "tlapack/lapack/lahqz_eig22.hpp"
 #include "tlapack/lapack/lahqz_shiftcolumn.hpp"
+#include "tlapack/lapack/rot_sequence.hpp"
 #include "tlapack/lapack/svd22.hpp"
 
 namespace tlapack {
@@ -460,6 +461,12 @@ int lahqz(bool want_s,
             }
         }
 
+        // The last reflector of the sweep is applied to Q and Z together with
+        // the final 2x2 rotation, in one pass over their rows, by
+        // internal::larf3_rot(). These are its coefficients.
+        TA vq2(0), vq3(0), tauq(0);
+        TA vz2(0), vz3(0), tauz(0);
+
         // All the preparations are done, we can apply an implicit QZ
         // iteration
         for (idx_t i = istart2; i < istop - 2; ++i) {
@@ -512,7 +519,12 @@ int lahqz(bool want_s,
                     B(i + 1, j) = B(i + 1, j) - sum * t2;
                     B(i + 2, j) = B(i + 2, j) - sum * t3;
                 }
-                if (want_q) {
+                if (want_q && i + 3 == istop) {
+                    vq2 = v2;
+                    vq3 = v3;
+                    tauq = conj(t1);
+                }
+                else if (want_q) {
                     // Apply reflector to Q from the right
                     for (idx_t j = 0; j < n; ++j) {
                         sum = Q(j, i) + v2 * Q(j, i + 1) + v3 * Q(j, i + 2);
@@ -554,7 +566,12 @@ int lahqz(bool want_s,
                     A(j, i + 1) = A(j, i + 1) - sum * conj(t2);
                     A(j, i + 2) = A(j, i + 2) - sum * conj(t3);
                 }
-                if (want_z) {
+                if (want_z && i + 3 == istop) {
+                    vz2 = v2;
+                    vz3 = v3;
+                    tauz = conj(t1);
+                }
+                else if (want_z) {
                     // Apply reflector to Z from the right
                     for (idx_t j = 0; j < n; ++j) {
                         sum = Z(j, i) + v2 * Z(j, i + 1) + v3 * Z(j, i + 2);
@@ -598,7 +615,12 @@ int lahqz(bool want_s,
                 auto b1 = slice(B, i, range{i, istop_m});
                 auto b2 = slice(B, i + 1, range{i, istop_m});
                 rot(b1, b2, c2, s2);
-                if (want_q) {
+                if (want_q && i > istart2) {
+                    // Apply the last reflector and the rotation to Q
+                    auto Qi = slice(Q, range{0, n}, range{i - 1, i + 2});
+                    internal::larf3_rot(Qi, vq2, vq3, tauq, c2, s2);
+                }
+                else if (want_q) {
                     auto q1 = col(Q, i);
                     auto q2 = col(Q, i + 1);
                     rot(q1, q2, c2, conj(s2));
@@ -618,7 +640,12 @@ int lahqz(bool want_s,
                 auto a1 = slice(A, range{istart_m, min(i + 4, ihi)}, i);
                 auto a2 = slice(A, range{istart_m, min(i + 4, ihi)}, i + 1);
                 rot(a1, a2, c2, conj(s2));
-                if (want_z) {
+                if (want_z && i > istart2) {
+                    // Apply the last reflector and the rotation to Z
+                    auto Zi = slice(Z, range{0, n}, range{i - 1, i + 2});
+                    internal::larf3_rot(Zi, vz2, vz3, tauz, c2, s2);
+                }
+                else if (want_z) {
                     auto z1 = col(Z, i);
                     auto z2 = col(Z, i + 1);
                     rot(z1, z2, c2, conj(s2));
@@ -17,6 +17,7 @@
 #include "tlapack/blas/copy.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/gemv2.hpp"
 #include "tlapack/blas/scal.hpp"
 #include "tlapack/blas/trmm.hpp"
 #include "tlapack/blas/trmv.hpp"
@@ -88,15 +89,11 @@ int lahr2(size_type<matrix_t> k,
             //
             // Update I-th column of A - Y * V**T
             // (Application of the reflectors from the right)
+            // The columns 0:i-1 of Y were applied in the previous step,
+            // together with the computation of Y(K+1:N,I-1)
             //
-            auto Y2 = slice(Y, range{k + 1, n}, range{0, i});
-            auto Vti = slice(A, k + i, range{0, i});
             auto b = slice(A, range{k + 1, n}, i);
-            for (idx_t j = 0; j < i; ++j)
-                Vti[j] = conj(Vti[j]);
-            gemv(NO_TRANS, -one, Y2, Vti, one, b);
-            for (idx_t j = 0; j < i; ++j)
-                Vti[j] = conj(Vti[j]);
+            axpy(-conj(A(k + i, i - 1)), slice(Y, range{k + 1, n}, i - 1), b);
             //
             // Apply I - V * T**T * V**T to this column (call it b) from the
             // left, using the last column of T as workspace
@@ -156,7 +153,19 @@ int lahr2(size_type<matrix_t> k,
         auto A3 = slice(A, range{k + i + 1, n}, range{0, i});
         gemv(CONJ_TRANS, one, A3, v, t);
         auto Y2 = slice(Y, range{k + 1, n}, range{0, i});
-        gemv(NO_TRANS, -one, Y2, t, one, y);
+        if (i + 1 < nb) {
+            // Also A(K+1:N,I+1) -= Y(K+1:N,0:I) * V(I+1,0:I)**T for the
+            // next step, reading Y2 only once
+            auto Vti = slice(A, k + i + 1, range{0, i});
+            auto b = slice(A, range{k + 1, n}, i + 1);
+            for (idx_t j = 0; j < i; ++j)
+                Vti[j] = conj(Vti[j]);
+            gemv2(NO_TRANS, NO_TRANS, -one, Y2, t, Vti, one, y, b);
+            for (idx_t j = 0; j < i; ++j)
+                Vti[j] = conj(Vti[j]);
+        }
+        else
+            gemv(NO_TRANS, -one, Y2, t, one, y);
         scal(tau[i], y);
         //
         // Compute T(0:I+1,I)
@@ -12,11 +12,97 @@
 #ifndef TLAPACK_LANGE_HH
 #define TLAPACK_LANGE_HH
 
+#include "tlapack/blas/level1_kernels.hpp"
 #include "tlapack/lapack/lassq.hpp"
 
 namespace tlapack {
 
+/// Norms of a matrix computed in one pass by lange_all()
+template <class real_t>
+struct LangeNorms {
+    real_t max;  ///< Maximum absolute value, Norm::Max
+    real_t one;  ///< 1-norm, Norm::One
+    real_t inf;  ///< Inf-norm, Norm::Inf
+    real_t fro;  ///< Frobenius norm, Norm::Fro
+};
+
+namespace internal {
+
+    /// Number of entries in each of the chunks of columns of lange()
+    constexpr std::size_t lange_chunk = 32768;
+
+    /// Number of rows in each of the blocks of rows of lange()
+    constexpr std::size_t lange_rowblock = 512;
+
+    /// norm := max(norm, x), where NaNs are propagated
+    template <class real_t>
+    constexpr void lange_update_max(real_t& norm, const real_t& x)
+    {
+        if (x > norm || isnan(x)) norm = x;
+    }
+
+    /// Adds |a|^2 to the sum of squares, using the real and imaginary parts
+    /// of a separately
+    template <class real_t, class T>
+    constexpr void lange_add_squares(BlueSum<real_t>& acc, const T& a)
+    {
+        if constexpr (is_complex<T>) {
+            acc.add(abs(real(a)));
+            acc.add(abs(imag(a)));
+        }
+        else
+            acc.add(abs(a));
+    }
+
+    /// |a|^2 computed without scaling
+    template <class T>
+    constexpr real_type<T> lange_square(const T& a)
+    {
+        if constexpr (is_complex<T>)
+            return real(a) * real(a) + imag(a) * imag(a);
+        else
+            return a * a;
+    }
+
+    /** Adds the squares of A(i0:i1,j) to the sum of squares
+     *
+     * sumsq is the unscaled sum of the squares of the entries. It is added
+     * to the accumulator of medium values if it is finite, not larger than
+     * tbig^2, and large enough that the squares that underflow do not change
+     * it, as in nrm2(). Otherwise, the entries are added again one by one
+     * with Blue's algorithm.
+     */
+    template <class real_t, class matrix_t, class idx_t>
+    void lange_add_column(BlueSum<real_t>& acc,
+                          const real_t& sumsq,
+                          const matrix_t& A,
+                          idx_t i0,
+                          idx_t i1,
+                          idx_t j)
+    {
+        const real_t tsml2 = acc.tsml * acc.tsml;
+        if (sumsq <= acc.tbig * acc.tbig &&
+            sumsq >= real_t(i1 - i0) * (tsml2 / ulp<real_t>()))
+            acc.amed += sumsq;
+        else
+            for (idx_t i = i0; i < i1; ++i)
+                lange_add_squares(acc, A(i, j));
+        acc.flush();
+    }
+
+}  // namespace internal
+
 /** Calculates the norm of a matrix.
+ *
+ * The matrix is split in independent chunks of columns (Norm::Max,
+ * Norm::One and Norm::Fro) or blocks of rows (Norm::Inf), which are
+ * processed in parallel when <T>LAPACK is built with TLAPACK_USE_OPENMP.
+ * The partial results are combined in a fixed order, so the result does not
+ * depend on the number of threads. For Norm::Fro, the squares of each
+ * column are first summed without scaling. Columns whose sum may have
+ * overflowed or lost accuracy to underflow are summed again with the three
+ * accumulators of Blue's algorithm, as in lassq(). A single scaling step is
+ * done at the end.
  *
  * @tparam norm_t Either Norm or any class that implements `operator Norm()`.
  *
@@ -32,6 +118,8 @@ namespace tlapack {
  *
  * @param[in] A m-by-n matrix.
  *
+ * @see lange_all() to compute all norms in one pass.
+ *
  * @ingroup auxiliary
  */
 template <TLAPACK_NORM norm_t, TLAPACK_SMATRIX matrix_t>
@@ -55,53 +143,180 @@ auto lange(norm_t normType, const matrix_t& A)
     // Norm value
     real_t norm(0);
 
-    if (normType == Norm::Max) {
-        for (idx_t j = 0; j < n; ++j) {
-            for (idx_t i = 0; i < m; ++i) {
-                real_t temp = abs(A(i, j));
+    if (normType == Norm::Inf) {
+        // Blocks of rows
+        const idx_t rb = min<idx_t>(m, internal::lange_rowblock);
+        const idx_t nblocks = (m + rb - 1) / rb;
+        std::vector<real_t> partial(nblocks);
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if (nblocks > 1)
+#endif
+        for (idx_t b = 0; b < nblocks; ++b) {
+            const idx_t i0 = b * rb;
+            const idx_t i1 = min(i0 + rb, m);
+
+            // Sums of the rows i0:i1, traversing A column by column
+            std::vector<real_t> sum(i1 - i0, real_t(0));
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = i0; i < i1; ++i)
+                    sum[i - i0] += abs(A(i, j));
 
-                if (temp > norm)
-                    norm = temp;
-                else {
-                    if (isnan(temp)) return temp;
+            real_t normb(0);
+            for (idx_t i = 0; i < i1 - i0; ++i)
+                internal::lange_update_max(normb, sum[i]);
+            partial[b] = normb;
+        }
+
+        for (idx_t b = 0; b < nblocks; ++b)
+            internal::lange_update_max(norm, partial[b]);
+    }
+    else {
+        // Chunks of columns
+        const idx_t nc = max<idx_t>(1, internal::lange_chunk / m);
+        const idx_t nchunks = (n + nc - 1) / nc;
+
+        if (normType == Norm::Fro) {
+            std::vector<internal::BlueSum<real_t>> partial(nchunks);
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if (nchunks > 1)
+#endif
+            for (idx_t c = 0; c < nchunks; ++c) {
+                const idx_t j1 = min((c + 1) * nc, n);
+                for (idx_t j = c * nc; j < j1; ++j) {
+                    const auto sq = [&](idx_t i) {
+                        return internal::lange_square(A(i, j));
+                    };
+                    const real_t sumsq = internal::dot4<real_t>(m, sq);
+                    internal::lange_add_column(partial[c], sumsq, A, idx_t(0),
+                                               m, j);
                 }
             }
+
+            for (idx_t c = 1; c < nchunks; ++c)
+                partial[0].merge(partial[c]);
+
+            real_t scale(1), sum(0);
+            partial[0].finalize(scale, sum);
+            norm = scale * sqrt(sum);
         }
-    }
-    else if (normType == Norm::Inf) {
-        for (idx_t i = 0; i < m; ++i) {
-            real_t sum(0);
-            for (idx_t j = 0; j < n; ++j)
-                sum += abs(A(i, j));
+        else {
+            std::vector<real_t> partial(nchunks);
 
-            if (sum > norm)
-                norm = sum;
-            else {
-                if (isnan(sum)) return sum;
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if (nchunks > 1)
+#endif
+            for (idx_t c = 0; c < nchunks; ++c) {
+                const idx_t j1 = min((c + 1) * nc, n);
+                real_t normc(0);
+                for (idx_t j = c * nc; j < j1; ++j) {
+                    if (normType == Norm::Max) {
+                        for (idx_t i = 0; i < m; ++i)
+                            internal::lange_update_max(normc, abs(A(i, j)));
+                    }
+                    else {
+                        real_t sum(0);
+                        for (idx_t i = 0; i < m; ++i)
+                            sum += abs(A(i, j));
+                        internal::lange_update_max(normc, sum);
+                    }
+                }
+                partial[c] = normc;
             }
+
+            for (idx_t c = 0; c < nchunks; ++c)
+                internal::lange_update_max(norm, partial[c]);
         }
     }
-    else if (normType == Norm::One) {
+
+    return norm;
+}
+
+/** Calculates the max-norm, 1-norm, Inf-norm and Frobenius norm of a matrix
+ * in one pass over its entries.
+ *
+ * The matrix is split in blocks of rows, which are processed in parallel
+ * when <T>LAPACK is built with TLAPACK_USE_OPENMP. Each block computes the
+ * sums of its rows and its contributions to the sums of the columns. The
+ * results are the same as the ones of lange().
+ *
+ * @param[in] A m-by-n matrix.
+ *
+ * @return LangeNorms with the four norms of A.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX matrix_t>
+auto lange_all(const matrix_t& A)
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+
+    // constants
+    const real_t zero(0);
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+
+    LangeNorms<real_t> norms{zero, zero, zero, zero};
+
+    // quick return
+    if (m == 0 || n == 0) return norms;
+
+    // Blocks of rows
+    const idx_t rb = min<idx_t>(m, internal::lange_rowblock);
+    const idx_t nblocks = (m + rb - 1) / rb;
+    std::vector<real_t> maxb(nblocks), infb(nblocks), colsums(nblocks * n);
+    std::vector<internal::BlueSum<real_t>> acc(nblocks);
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if (nblocks > 1)
+#endif
+    for (idx_t b = 0; b < nblocks; ++b) {
+        const idx_t i0 = b * rb;
+        const idx_t i1 = min(i0 + rb, m);
+
+        std::vector<real_t> rowsum(i1 - i0, zero);
+        real_t maxabs(0);
         for (idx_t j = 0; j < n; ++j) {
-            real_t sum(0);
-            for (idx_t i = 0; i < m; ++i)
-                sum += abs(A(i, j));
-
-            if (sum > norm)
-                norm = sum;
-            else {
-                if (isnan(sum)) return sum;
+            real_t colsum(0), colsq(0);
+            for (idx_t i = i0; i < i1; ++i) {
+                const real_t temp = abs(A(i, j));
+                internal::lange_update_max(maxabs, temp);
+                colsum += temp;
+                rowsum[i - i0] += temp;
+                colsq += internal::lange_square(A(i, j));
             }
+            colsums[b * n + j] = colsum;
+            internal::lange_add_column(acc[b], colsq, A, i0, i1, j);
         }
+
+        real_t inf(0);
+        for (idx_t i = 0; i < i1 - i0; ++i)
+            internal::lange_update_max(inf, rowsum[i]);
+        maxb[b] = maxabs;
+        infb[b] = inf;
     }
-    else {
-        real_t scale(0), sum(1);
-        for (idx_t j = 0; j < n; ++j)
-            lassq(col(A, j), scale, sum);
-        norm = scale * sqrt(sum);
+
+    // Combine the partial results in a fixed order
+    for (idx_t b = 0; b < nblocks; ++b) {
+        internal::lange_update_max(norms.max, maxb[b]);
+        internal::lange_update_max(norms.inf, infb[b]);
+    }
+    for (idx_t j = 0; j < n; ++j) {
+        real_t sum(0);
+        for (idx_t b = 0; b < nblocks; ++b)
+            sum += colsums[b * n + j];
+        internal::lange_update_max(norms.one, sum);
     }
+    for (idx_t b = 1; b < nblocks; ++b)
+        acc[0].merge(acc[b]);
+    real_t scale(1), sum(0);
+    acc[0].finalize(scale, sum);
+    norms.fro = scale * sqrt(sum);
 
-    return norm;
+    return norms;
 }
 
 }  // namespace tlapack
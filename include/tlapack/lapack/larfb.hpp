@@ -19,6 +19,16 @@
 
 namespace tlapack {
 
+/**
+ * Options struct for larfb
+ */
+struct LarfbOpts {
+    size_t nc = 256;  ///< Maximum number of columns (side = Side::Left) or
+                      ///< rows (side = Side::Right) of C in each panel.
+                      ///< Panels are independent and may be processed in
+                      ///< parallel. If nc = 0, C is not split.
+};
+
 /** Worspace query of larfb()
  *
  * @param[in] side
@@ -58,6 +68,8 @@ namespace tlapack {
  * @param[in] C
  *     On entry, the m-by-n matrix C.
  *
+ * @param[in] opts Options.
+ *
  * @return WorkInfo The amount workspace required.
  *
  * @ingroup workspace_query
@@ -76,7 +88,8 @@ constexpr WorkInfo larfb_worksize(side_t side,
                                   storage_t storeMode,
                                   const matrixV_t& V,
                                   const matrixT_t& Tmatrix,
-                                  const matrixC_t& C)
+                                  const matrixC_t& C,
+                                  const LarfbOpts& opts = {})
 {
     using idx_t = size_type<matrixC_t>;
     using work_t = matrix_type<matrixV_t, matrixC_t>;
@@ -92,6 +105,324 @@ constexpr WorkInfo larfb_worksize(side_t side,
         return WorkInfo(0);
 }
 
+namespace internal {
+
+    /** Applies the block reflector to C using the workspace matrix W, which is
+     * k-by-n if side = Side::Left and m-by-k if side = Side::Right.
+     *
+     * @see larfb_work()
+     *
+     * @ingroup auxiliary
+     */
+    template <TLAPACK_SMATRIX matrixV_t,
+              TLAPACK_MATRIX matrixT_t,
+              TLAPACK_SMATRIX matrixC_t,
+              TLAPACK_SMATRIX matrixW_t,
+              TLAPACK_SIDE side_t,
+              TLAPACK_OP trans_t,
+              TLAPACK_DIRECTION direction_t,
+              TLAPACK_STOREV storage_t>
+    void larfb_panel(side_t side,
+                     trans_t trans,
+                     direction_t direction,
+                     storage_t storeMode,
+                     const matrixV_t& V,
+                     const matrixT_t& Tmatrix,
+                     matrixC_t& C,
+                     matrixW_t& W)
+    {
+        using idx_t = size_type<matrixC_t>;
+        using T = type_t<matrixW_t>;
+        using real_t = real_type<T>;
+
+        using range = pair<idx_t, idx_t>;
+
+        // constants
+        const real_t one(1);
+        const idx_t m = nrows(C);
+        const idx_t n = ncols(C);
+        const idx_t k = nrows(Tmatrix);
+
+        if (storeMode == StoreV::Columnwise) {
+            if (direction == Direction::Forward) {
+                if (side == Side::Left) {
+                    // W is an k-by-n matrix
+                    // V is an m-by-k matrix
+
+                    // Matrix views
+                    const auto V1 = rows(V, range{0, k});
+                    const auto V2 = rows(V, range{k, m});
+                    auto C1 = rows(C, range{0, k});
+                    auto C2 = rows(C, range{k, m});
+
+                    // W := C1
+                    lacpy(GENERAL, C1, W);
+                    // W := V1^H W
+                    trmm(LEFT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one,
+                         V1, W);
+                    if (m > k)
+                        // W := W + V2^H C2
+                        gemm(CONJ_TRANS, NO_TRANS, one, V2, C2, one, W);
+                    // W := op(Tmatrix) W
+                    trmm(LEFT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one,
+                         Tmatrix, W);
+                    if (m > k)
+                        // C2 := C2 - V2 W
+                        gemm(NO_TRANS, NO_TRANS, -one, V2, W, one, C2);
+                    // W := - V1 W
+                    trmm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, -one,
+                         V1, W);
+
+                    // C1 := C1 + W
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < k; ++i)
+                            C1(i, j) += W(i, j);
+                }
+                else {  // side == Side::Right
+                    // W is an m-by-k matrix
+                    // V is an n-by-k matrix
+
+                    // Matrix views
+                    const auto V1 = rows(V, range{0, k});
+                    const auto V2 = rows(V, range{k, n});
+                    auto C1 = cols(C, range{0, k});
+                    auto C2 = cols(C, range{k, n});
+
+                    // W := C1
+                    lacpy(GENERAL, C1, W);
+                    // W := W V1
+                    trmm(RIGHT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one,
+                         V1, W);
+                    if (n > k)
+                        // W := W + C2 V2
+                        gemm(NO_TRANS, NO_TRANS, one, C2, V2, one, W);
+                    // W := W op(Tmatrix)
+                    trmm(RIGHT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one,
+                         Tmatrix, W);
+                    if (n > k)
+                        // C2 := C2 - W V2^H
+                        gemm(NO_TRANS, CONJ_TRANS, -one, W, V2, one, C2);
+                    // W := - W V1^H
+                    trmm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG,
+                         -one, V1, W);
+
+                    // C1 := C1 + W
+                    for (idx_t j = 0; j < k; ++j)
+                        for (idx_t i = 0; i < m; ++i)
+                            C1(i, j) += W(i, j);
+                }
+            }
+            else {  // direct == Direction::Backward
+                if (side == Side::Left) {
+                    // W is an k-by-n matrix
+                    // V is an m-by-k matrix
+
+                    // Matrix views
+                    const auto V1 = rows(V, range{0, m - k});
+                    const auto V2 = rows(V, range{m - k, m});
+                    auto C1 = rows(C, range{0, m - k});
+                    auto C2 = rows(C, range{m - k, m});
+
+                    // W := C2
+                    lacpy(GENERAL, C2, W);
+                    // W := V2^H W
+                    trmm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one,
+                         V2, W);
+                    if (m > k)
+                        // W := W + V1^H C1
+                        gemm(CONJ_TRANS, NO_TRANS, one, V1, C1, one, W);
+                    // W := op(Tmatrix) W
+                    trmm(LEFT_SIDE, LOWER_TRIANGLE, trans, NON_UNIT_DIAG, one,
+                         Tmatrix, W);
+                    if (m > k)
+                        // C1 := C1 - V1 W
+                        gemm(NO_TRANS, NO_TRANS, -one, V1, W, one, C1);
+                    // W := - V2 W
+                    trmm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, -one,
+                         V2, W);
+
+                    // C2 := C2 + W
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < k; ++i)
+                            C2(i, j) += W(i, j);
+                }
+                else {  // side == Side::Right
+                    // W is an m-by-k matrix
+                    // V is an n-by-k matrix
+
+                    // Matrix views
+                    const auto V1 = rows(V, range{0, n - k});
+                    const auto V2 = rows(V, range{n - k, n});
+                    auto C1 = cols(C, range{0, n - k});
+                    auto C2 = cols(C, range{n - k, n});
+
+                    // W := C2
+                    lacpy(GENERAL, C2, W);
+                    // W := W V2
+                    trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, one,
+                         V2, W);
+                    if (n > k)
+                        // W := W + C1 V1
+                        gemm(NO_TRANS, NO_TRANS, one, C1, V1, one, W);
+                    // W := W op(Tmatrix)
+                    trmm(RIGHT_SIDE, LOWER_TRIANGLE, trans, NON_UNIT_DIAG, one,
+                         Tmatrix, W);
+                    if (n > k)
+                        // C1 := C1 - W V1^H
+                        gemm(NO_TRANS, CONJ_TRANS, -one, W, V1, one, C1);
+                    // W := - W V2^H
+                    trmm(RIGHT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG,
+                         -one, V2, W);
+
+                    // C2 := C2 + W
+                    for (idx_t j = 0; j < k; ++j)
+                        for (idx_t i = 0; i < m; ++i)
+                            C2(i, j) += W(i, j);
+                }
+            }
+        }
+        else {  // storeV == StoreV::Rowwise
+            if (direction == Direction::Forward) {
+                if (side == Side::Left) {
+                    // W is an k-by-n matrix
+                    // V is an k-by-m matrix
+
+                    // Matrix views
+                    const auto V1 = cols(V, range{0, k});
+                    const auto V2 = cols(V, range{k, m});
+                    auto C1 = rows(C, range{0, k});
+                    auto C2 = rows(C, range{k, m});
+
+                    // W := C1
+                    lacpy(GENERAL, C1, W);
+                    // W := V1 W
+                    trmm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, one,
+                         V1, W);
+                    if (m > k)
+                        // W := W + V2 C2
+                        gemm(NO_TRANS, NO_TRANS, one, V2, C2, one, W);
+                    // W := op(Tmatrix) W
+                    trmm(LEFT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one,
+                         Tmatrix, W);
+                    if (m > k)
+                        // C2 := C2 - V2^H W
+                        gemm(CONJ_TRANS, NO_TRANS, -one, V2, W, one, C2);
+                    // W := - V1^H W
+                    trmm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, -one,
+                         V1, W);
+
+                    // C1 := C1 - W
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < k; ++i)
+                            C1(i, j) += W(i, j);
+                }
+                else {  // side == Side::Right
+                    // W is an m-by-k matrix
+                    // V is an k-by-n matrix
+
+                    // Matrix views
+                    const auto V1 = cols(V, range{0, k});
+                    const auto V2 = cols(V, range{k, n});
+                    auto C1 = cols(C, range{0, k});
+                    auto C2 = cols(C, range{k, n});
+
+                    // W := C1
+                    lacpy(GENERAL, C1, W);
+                    // W := W V1^H
+                    trmm(RIGHT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one,
+                         V1, W);
+                    if (n > k)
+                        // W := W + C2 V2^H
+                        gemm(NO_TRANS, CONJ_TRANS, one, C2, V2, one, W);
+                    // W := W op(Tmatrix)
+                    trmm(RIGHT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one,
+                         Tmatrix, W);
+                    if (n > k)
+                        // C2 := C2 - W V2
+                        gemm(NO_TRANS, NO_TRANS, -one, W, V2, one, C2);
+                    // W := - W V1
+                    trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, -one,
+                         V1, W);
+
+                    // C1 := C1 + W
+                    for (idx_t j = 0; j < k; ++j)
+                        for (idx_t i = 0; i < m; ++i)
+                            C1(i, j) += W(i, j);
+                }
+            }
+            else {  // direct == Direction::Backward
+                if (side == Side::Left) {
+                    // W is an k-by-n matrix
+                    // V is an k-by-m matrix
+
+                    // Matrix views
+                    const auto V1 = cols(V, range{0, m - k});
+                    const auto V2 = cols(V, range{m - k, m});
+                    auto C1 = rows(C, range{0, m - k});
+                    auto C2 = rows(C, range{m - k, m});
+
+                    // W := C2
+                    lacpy(GENERAL, C2, W);
+                    // W := V2 W
+                    trmm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one,
+                         V2, W);
+                    if (m > k)
+                        // W := W + V1 C1
+                        gemm(NO_TRANS, NO_TRANS, one, V1, C1, one, W);
+                    // W := op(Tmatrix) W
+                    trmm(LEFT_SIDE, LOWER_TRIANGLE, trans, NON_UNIT_DIAG, one,
+                         Tmatrix, W);
+                    if (m > k)
+                        // C1 := C1 - V1^H W
+                        gemm(CONJ_TRANS, NO_TRANS, -one, V1, W, one, C1);
+                    // W := - V2^H W
+                    trmm(LEFT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, -one,
+                         V2, W);
+
+                    // C2 := C2 + W
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < k; ++i)
+                            C2(i, j) += W(i, j);
+                }
+                else {  // side == Side::Right
+                    // W is an m-by-k matrix
+                    // V is an k-by-n matrix
+
+                    // Matrix views
+                    const auto V1 = cols(V, range{0, n - k});
+                    const auto V2 = cols(V, range{n - k, n});
+                    auto C1 = cols(C, range{0, n - k});
+                    auto C2 = cols(C, range{n - k, n});
+
+                    // W := C2
+                    lacpy(GENERAL, C2, W);
+                    // W := W V2^H
+                    trmm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one,
+                         V2, W);
+                    if (n > k)
+                        // W := W + C1 V1^H
+                        gemm(NO_TRANS, CONJ_TRANS, one, C1, V1, one, W);
+                    // W := W op(Tmatrix)
+                    trmm(RIGHT_SIDE, LOWER_TRIANGLE, trans, NON_UNIT_DIAG, one,
+                         Tmatrix, W);
+                    if (n > k)
+                        // C1 := C1 - W V1
+                        gemm(NO_TRANS, NO_TRANS, -one, W, V1, one, C1);
+                    // W := - W V2
+                    trmm(RIGHT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, -one,
+                         V2, W);
+
+                    // C2 := C2 + W
+                    for (idx_t j = 0; j < k; ++j)
+                        for (idx_t i = 0; i < m; ++i)
+                            C2(i, j) += W(i, j);
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
 /** @copybrief larfb()
  * Workspace is provided as an argument.
  * @copydetails larfb()
@@ -115,16 +446,13 @@ int larfb_work(side_t side,
                const matrixV_t& V,
                const matrixT_t& Tmatrix,
                matrixC_t& C,
-               work_t& work)
+               work_t& work,
+               const LarfbOpts& opts = {})
 {
     using idx_t = size_type<matrixC_t>;
-    using T = type_t<work_t>;
-    using real_t = real_type<T>;
-
     using range = pair<idx_t, idx_t>;
 
     // constants
-    const real_t one(1);
     const idx_t m = nrows(C);
     const idx_t n = ncols(C);
     const idx_t k = nrows(Tmatrix);
@@ -150,283 +478,33 @@ int larfb_work(side_t side,
     if (m <= 0 || n <= 0 || k <= 0) return 0;
 
     // Matrix W
-    auto [W, work1] =
-        (side == Side::Left) ? reshape(work, k, n) : reshape(work, m, k);
-
-    if (storeMode == StoreV::Columnwise) {
-        if (direction == Direction::Forward) {
-            if (side == Side::Left) {
-                // W is an k-by-n matrix
-                // V is an m-by-k matrix
-
-                // Matrix views
-                const auto V1 = rows(V, range{0, k});
-                const auto V2 = rows(V, range{k, m});
-                auto C1 = rows(C, range{0, k});
-                auto C2 = rows(C, range{k, m});
-
-                // W := C1
-                lacpy(GENERAL, C1, W);
-                // W := V1^H W
-                trmm(LEFT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one, V1,
-                     W);
-                if (m > k)
-                    // W := W + V2^H C2
-                    gemm(CONJ_TRANS, NO_TRANS, one, V2, C2, one, W);
-                // W := op(Tmatrix) W
-                trmm(LEFT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one,
-                     Tmatrix, W);
-                if (m > k)
-                    // C2 := C2 - V2 W
-                    gemm(NO_TRANS, NO_TRANS, -one, V2, W, one, C2);
-                // W := - V1 W
-                trmm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, -one, V1,
-                     W);
-
-                // C1 := C1 + W
-                for (idx_t j = 0; j < n; ++j)
-                    for (idx_t i = 0; i < k; ++i)
-                        C1(i, j) += W(i, j);
-            }
-            else {  // side == Side::Right
-                // W is an m-by-k matrix
-                // V is an n-by-k matrix
-
-                // Matrix views
-                const auto V1 = rows(V, range{0, k});
-                const auto V2 = rows(V, range{k, n});
-                auto C1 = cols(C, range{0, k});
-                auto C2 = cols(C, range{k, n});
-
-                // W := C1
-                lacpy(GENERAL, C1, W);
-                // W := W V1
-                trmm(RIGHT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, V1,
-                     W);
-                if (n > k)
-                    // W := W + C2 V2
-                    gemm(NO_TRANS, NO_TRANS, one, C2, V2, one, W);
-                // W := W op(Tmatrix)
-                trmm(RIGHT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one,
-                     Tmatrix, W);
-                if (n > k)
-                    // C2 := C2 - W V2^H
-                    gemm(NO_TRANS, CONJ_TRANS, -one, W, V2, one, C2);
-                // W := - W V1^H
-                trmm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, -one,
-                     V1, W);
-
-                // C1 := C1 + W
-                for (idx_t j = 0; j < k; ++j)
-                    for (idx_t i = 0; i < m; ++i)
-                        C1(i, j) += W(i, j);
-            }
+    auto W = (side == Side::Left) ? reshape(work, k, n).first
+                                  : reshape(work, m, k).first;
+
+    // C is split into panels of at most nc columns (side = Side::Left) or nc
+    // rows (side = Side::Right). The panels are independent, and each one
+    // uses the corresponding columns or rows of W.
+    const idx_t nc = (opts.nc > 0) ? (idx_t)opts.nc : max(m, n);
+    const idx_t npanels =
+        (side == Side::Left) ? (n + nc - 1) / nc : (m + nc - 1) / nc;
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if (npanels > 1)
+#endif
+    for (idx_t p = 0; p < npanels; ++p) {
+        if (side == Side::Left) {
+            const range cols_p{p * nc, min((p + 1) * nc, n)};
+            auto Cp = cols(C, cols_p);
+            auto Wp = cols(W, cols_p);
+            internal::larfb_panel(side, trans, direction, storeMode, V,
+                                  Tmatrix, Cp, Wp);
         }
-        else {  // direct == Direction::Backward
-            if (side == Side::Left) {
-                // W is an k-by-n matrix
-                // V is an m-by-k matrix
-
-                // Matrix views
-                const auto V1 = rows(V, range{0, m - k});
-                const auto V2 = rows(V, range{m - k, m});
-                auto C1 = rows(C, range{0, m - k});
-                auto C2 = rows(C, range{m - k, m});
-
-                // W := C2
-                lacpy(GENERAL, C2, W);
-                // W := V2^H W
-                trmm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one, V2,
-                     W);
-                if (m > k)
-                    // W := W + V1^H C1
-                    gemm(CONJ_TRANS, NO_TRANS, one, V1, C1, one, W);
-                // W := op(Tmatrix) W
-                trmm(LEFT_SIDE, LOWER_TRIANGLE, trans, NON_UNIT_DIAG, one,
-                     Tmatrix, W);
-                if (m > k)
-                    // C1 := C1 - V1 W
-                    gemm(NO_TRANS, NO_TRANS, -one, V1, W, one, C1);
-                // W := - V2 W
-                trmm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, -one, V2,
-                     W);
-
-                // C2 := C2 + W
-                for (idx_t j = 0; j < n; ++j)
-                    for (idx_t i = 0; i < k; ++i)
-                        C2(i, j) += W(i, j);
-            }
-            else {  // side == Side::Right
-                // W is an m-by-k matrix
-                // V is an n-by-k matrix
-
-                // Matrix views
-                const auto V1 = rows(V, range{0, n - k});
-                const auto V2 = rows(V, range{n - k, n});
-                auto C1 = cols(C, range{0, n - k});
-                auto C2 = cols(C, range{n - k, n});
-
-                // W := C2
-                lacpy(GENERAL, C2, W);
-                // W := W V2
-                trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, V2,
-                     W);
-                if (n > k)
-                    // W := W + C1 V1
-                    gemm(NO_TRANS, NO_TRANS, one, C1, V1, one, W);
-                // W := W op(Tmatrix)
-                trmm(RIGHT_SIDE, LOWER_TRIANGLE, trans, NON_UNIT_DIAG, one,
-                     Tmatrix, W);
-                if (n > k)
-                    // C1 := C1 - W V1^H
-                    gemm(NO_TRANS, CONJ_TRANS, -one, W, V1, one, C1);
-                // W := - W V2^H
-                trmm(RIGHT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, -one,
-                     V2, W);
-
-                // C2 := C2 + W
-                for (idx_t j = 0; j < k; ++j)
-                    for (idx_t i = 0; i < m; ++i)
-                        C2(i, j) += W(i, j);
-            }
-        }
-    }
-    else {  // storeV == StoreV::Rowwise
-        if (direction == Direction::Forward) {
-            if (side == Side::Left) {
-                // W is an k-by-n matrix
-                // V is an k-by-m matrix
-
-                // Matrix views
-                const auto V1 = cols(V, range{0, k});
-                const auto V2 = cols(V, range{k, m});
-                auto C1 = rows(C, range{0, k});
-                auto C2 = rows(C, range{k, m});
-
-                // W := C1
-                lacpy(GENERAL, C1, W);
-                // W := V1 W
-                trmm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, V1,
-                     W);
-                if (m > k)
-                    // W := W + V2 C2
-                    gemm(NO_TRANS, NO_TRANS, one, V2, C2, one, W);
-                // W := op(Tmatrix) W
-                trmm(LEFT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one,
-                     Tmatrix, W);
-                if (m > k)
-                    // C2 := C2 - V2^H W
-                    gemm(CONJ_TRANS, NO_TRANS, -one, V2, W, one, C2);
-                // W := - V1^H W
-                trmm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, -one, V1,
-                     W);
-
-                // C1 := C1 - W
-                for (idx_t j = 0; j < n; ++j)
-                    for (idx_t i = 0; i < k; ++i)
-                        C1(i, j) += W(i, j);
-            }
-            else {  // side == Side::Right
-                // W is an m-by-k matrix
-                // V is an k-by-n matrix
-
-                // Matrix views
-                const auto V1 = cols(V, range{0, k});
-                const auto V2 = cols(V, range{k, n});
-                auto C1 = cols(C, range{0, k});
-                auto C2 = cols(C, range{k, n});
-
-                // W := C1
-                lacpy(GENERAL, C1, W);
-                // W := W V1^H
-                trmm(RIGHT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one, V1,
-                     W);
-                if (n > k)
-                    // W := W + C2 V2^H
-                    gemm(NO_TRANS, CONJ_TRANS, one, C2, V2, one, W);
-                // W := W op(Tmatrix)
-                trmm(RIGHT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one,
-                     Tmatrix, W);
-                if (n > k)
-                    // C2 := C2 - W V2
-                    gemm(NO_TRANS, NO_TRANS, -one, W, V2, one, C2);
-                // W := - W V1
-                trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, -one, V1,
-                     W);
-
-                // C1 := C1 + W
-                for (idx_t j = 0; j < k; ++j)
-                    for (idx_t i = 0; i < m; ++i)
-                        C1(i, j) += W(i, j);
-            }
-        }
-        else {  // direct == Direction::Backward
-            if (side == Side::Left) {
-                // W is an k-by-n matrix
-                // V is an k-by-m matrix
-
-                // Matrix views
-                const auto V1 = cols(V, range{0, m - k});
-                const auto V2 = cols(V, range{m - k, m});
-                auto C1 = rows(C, range{0, m - k});
-                auto C2 = rows(C, range{m - k, m});
-
-                // W := C2
-                lacpy(GENERAL, C2, W);
-                // W := V2 W
-                trmm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, V2,
-                     W);
-                if (m > k)
-                    // W := W + V1 C1
-                    gemm(NO_TRANS, NO_TRANS, one, V1, C1, one, W);
-                // W := op(Tmatrix) W
-                trmm(LEFT_SIDE, LOWER_TRIANGLE, trans, NON_UNIT_DIAG, one,
-                     Tmatrix, W);
-                if (m > k)
-                    // C1 := C1 - V1^H W
-                    gemm(CONJ_TRANS, NO_TRANS, -one, V1, W, one, C1);
-                // W := - V2^H W
-                trmm(LEFT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, -one, V2,
-                     W);
-
-                // C2 := C2 + W
-                for (idx_t j = 0; j < n; ++j)
-                    for (idx_t i = 0; i < k; ++i)
-                        C2(i, j) += W(i, j);
-            }
-            else {  // side == Side::Right
-                // W is an m-by-k matrix
-                // V is an k-by-n matrix
-
-                // Matrix views
-                const auto V1 = cols(V, range{0, n - k});
-                const auto V2 = cols(V, range{n - k, n});
-                auto C1 = cols(C, range{0, n - k});
-                auto C2 = cols(C, range{n - k, n});
-
-                // W := C2
-                lacpy(GENERAL, C2, W);
-                // W := W V2^H
-                trmm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one, V2,
-                     W);
-                if (n > k)
-                    // W := W + C1 V1^H
-                    gemm(NO_TRANS, CONJ_TRANS, one, C1, V1, one, W);
-                // W := W op(Tmatrix)
-                trmm(RIGHT_SIDE, LOWER_TRIANGLE, trans, NON_UNIT_DIAG, one,
-                     Tmatrix, W);
-                if (n > k)
-                    // C1 := C1 - W V1
-                    gemm(NO_TRANS, NO_TRANS, -one, W, V1, one, C1);
-                // W := - W V2
-                trmm(RIGHT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, -one, V2,
-                     W);
-
-                // C2 := C2 + W
-                for (idx_t j = 0; j < k; ++j)
-                    for (idx_t i = 0; i < m; ++i)
-                        C2(i, j) += W(i, j);
-            }
+        else {
+            const range rows_p{p * nc, min((p + 1) * nc, m)};
+            auto Cp = rows(C, rows_p);
+            auto Wp = rows(W, rows_p);
+            internal::larfb_panel(side, trans, direction, storeMode, V,
+                                  Tmatrix, Cp, Wp);
         }
     }
 
@@ -475,6 +553,11 @@ int larfb_work(side_t side,
  *     On entry, the m-by-n matrix C.
  *     On exit, C is overwritten by $H C$ or $H^H C$ or $C H$ or $C H^H$.
  *
+ * @param[in] opts Options.
+ *     - @c opts.nc: C is split into panels of at most opts.nc columns
+ *       (side = Side::Left) or rows (side = Side::Right). The panels are
+ *       updated in parallel when <T>LAPACK is built with TLAPACK_USE_OPENMP.
+ *
  * @par Further Details
  *
  * The shape of the matrix V and the storage of the vectors which define
@@ -515,7 +598,8 @@ int larfb(side_t side,
           storage_t storeMode,
           const matrixV_t& V,
           const matrixT_t& Tmatrix,
-          matrixC_t& C)
+          matrixC_t& C,
+          const LarfbOpts& opts = {})
 {
     using idx_t = size_type<matrixC_t>;
     using work_t = matrix_type<matrixV_t, matrixC_t>;
@@ -536,12 +620,13 @@ int larfb(side_t side,
     if (m <= 0 || n <= 0 || k <= 0) return 0;
 
     // Allocates workspace
-    WorkInfo workinfo =
-        larfb_worksize<T>(side, trans, direction, storeMode, V, Tmatrix, C);
+    WorkInfo workinfo = larfb_worksize<T>(side, trans, direction, storeMode,
+                                          V, Tmatrix, C, opts);
     std::vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
-    return larfb_work(side, trans, direction, storeMode, V, Tmatrix, C, work);
+    return larfb_work(side, trans, direction, storeMode, V, Tmatrix, C, work,
+                      opts);
 }
 
 }  // namespace tlapack
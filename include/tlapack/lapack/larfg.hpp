@@ -15,6 +15,7 @@
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/nrm2.hpp"
 #include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/ladiv.hpp"
 #include "tlapack/lapack/lapy2.hpp"
 #include "tlapack/lapack/lapy3.hpp"
 #include "tlapack/lapack/rscl.hpp"
@@ -51,6 +52,9 @@ namespace tlapack {
  *
  * Otherwise  1 <= real(tau) <= 2 and abs(tau-1) <= 1.
  *
+ * x is read once to compute its norm and once to form y. If x must be scaled
+ * to avoid underflow, the scaling is applied while forming y.
+ *
  * @param[in] storeMode
  *     Indicates how the vectors which define the elementary reflectors are
  * stored:
@@ -101,16 +105,16 @@ void larfg(storage_t storeMode,
                                    : lapy3(real(alpha), imag(alpha), xnorm);
         real_t beta = (real(alpha) < zero) ? temp : -temp;
 
-        // Scale if needed
+        // Scale if needed. The scaling of x is deferred to the pass that
+        // computes y, and the norm of the scaled x is updated in place
         idx_t knt = 0;
         if (abs(beta) < safemin) {
             while ((abs(beta) < safemin) && (knt < 20)) {
                 knt++;
-                scal(rsafemin, x);
+                xnorm *= rsafemin;
                 beta *= rsafemin;
                 alpha *= rsafemin;
             }
-            xnorm = nrm2(x);
             temp = (is_real<T>) ? lapy2(real(alpha), xnorm)
                                 : lapy3(real(alpha), imag(alpha), xnorm);
             beta = (real(alpha) < zero) ? temp : -temp;
@@ -118,7 +122,31 @@ void larfg(storage_t storeMode,
 
         // compute tau and y
         tau = (beta - alpha) / beta;
-        rscl(alpha - beta, x);
+        if (abs(beta) >= safemin && abs(beta) <= rsafemin) {
+            // safemin <= |alpha - beta| <= 2 rsafemin, so the reciprocal is
+            // safe to compute and y is formed in a single pass over x
+            T r;
+            if constexpr (is_complex<T>)
+                r = ladiv(T(one), alpha - beta);
+            else
+                r = one / (alpha - beta);
+            if (knt == 0)
+                scal(r, x);
+            else {
+                const idx_t n = size(x);
+                for (idx_t i = 0; i < n; ++i) {
+                    T xi = x[i];
+                    for (idx_t j = 0; j < knt; ++j)
+                        xi *= rsafemin;
+                    x[i] = xi * r;
+                }
+            }
+        }
+        else {
+            for (idx_t j = 0; j < knt; ++j)
+                scal(rsafemin, x);
+            rscl(alpha - beta, x);
+        }
         if (storeMode == StoreV::Rowwise) tau = conj(tau);
 
         // Scale if needed
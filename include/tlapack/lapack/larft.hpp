@@ -16,9 +16,18 @@
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/gemv.hpp"
 #include "tlapack/blas/trmv.hpp"
+#include "tlapack/lapack/larft_recursive.hpp"
 
 namespace tlapack {
 
+/// @brief Variants of the algorithm to form the triangular factor T.
+enum class LarftVariant : char { Level2 = '2', Recursive = 'R' };
+
+/// @brief Options struct for larft()
+struct LarftOpts {
+    LarftVariant variant = LarftVariant::Level2;  ///< Variant of the algorithm
+};
+
 /** Forms the triangular factor T of a block reflector H of order n,
  * which is defined as a product of k elementary reflectors.
  *
@@ -82,6 +91,12 @@ namespace tlapack {
  *     - Direction::Forward:  T is upper triangular.
  *     - Direction::Backward: T is lower triangular.
  *
+ * @param[in] opts Options.
+ *     - @c opts.variant:
+ *       - Level2 = '2': builds T one column at a time with gemv and trmv.
+ *       - Recursive = 'R': calls larft_recursive(), which builds T with
+ *         level-3 operations. Preferred for wide panels.
+ *
  * @ingroup auxiliary
  */
 template <TLAPACK_DIRECTION direction_t,
@@ -93,7 +108,8 @@ int larft(direction_t direction,
           storage_t storeMode,
           const matrixV_t& V,
           const vector_t& tau,
-          matrixT_t& T)
+          matrixT_t& T,
+          const LarftOpts& opts = {})
 {
     // data traits
     using scalar_t = type_t<matrixT_t>;
@@ -118,10 +134,16 @@ int larft(direction_t direction,
     tlapack_check_false(
         k > ((storeMode == StoreV::Columnwise) ? ncols(V) : nrows(V)));
     tlapack_check_false(nrows(T) < k || ncols(T) < k);
+    tlapack_check_false(opts.variant != LarftVariant::Level2 &&
+                        opts.variant != LarftVariant::Recursive);
 
     // Quick return
     if (n == 0 || k == 0) return 0;
 
+    // Call the recursive variant
+    if (opts.variant == LarftVariant::Recursive)
+        return larft_recursive(direction, storeMode, V, tau, T);
+
     if (direction == Direction::Forward) {
         // First iteration:
         T(0, 0) = tau[0];
@@ -0,0 +1,222 @@
+/// @file larft_recursive.hpp Forms the triangular factor T of a block
+/// reflector using a recursive algorithm.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LARFT_RECURSIVE_HH
+#define TLAPACK_LARFT_RECURSIVE_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/trmm.hpp"
+
+namespace tlapack {
+
+/** Forms the triangular factor T of a block reflector H of order n,
+ * which is defined as a product of k elementary reflectors.
+ *
+ * This is the recursive variant of larft(). The k reflectors are split in
+ * two halves, whose triangular factors T11 and T22 are computed recursively.
+ * The off-diagonal block is then obtained with level-3 operations. For
+ * direction = Direction::Forward and storeMode = StoreV::Columnwise,
+ * \[
+ *      T12 = - T11 * ( V1^H * V2 ) * T22,
+ * \]
+ * where V1^H * V2 is computed with one trmm() on the unit triangular part of
+ * V2 and one gemm() on the remaining rows. The other combinations of
+ * direction and storeMode are analogous.
+ *
+ * @param[in] direction
+ *     Indicates how H is formed from a product of elementary reflectors.
+ *     - Direction::Forward:  $H = H(1) H(2) ... H(k)$.
+ *     - Direction::Backward: $H = H(k) ... H(2) H(1)$.
+ *
+ * @param[in] storeMode
+ *     Indicates how the vectors which define the elementary reflectors are
+ * stored:
+ *     - StoreV::Columnwise.
+ *     - StoreV::Rowwise.
+ *
+ * @param[in] V
+ *     - If storeMode = StoreV::Columnwise: n-by-k matrix V.
+ *     - If storeMode = StoreV::Rowwise:    k-by-n matrix V.
+ *     n >= k.
+ *
+ * @param[in] tau Vector of length k containing the scalar factors
+ *      of the elementary reflectors H.
+ *
+ * @param[out] T Matrix of size k-by-k containing the triangular factors
+ *      of the block reflector.
+ *     - Direction::Forward:  T is upper triangular.
+ *     - Direction::Backward: T is lower triangular.
+ *
+ * @see larft() for the shape of V.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_DIRECTION direction_t,
+          TLAPACK_STOREV storage_t,
+          TLAPACK_SMATRIX matrixV_t,
+          TLAPACK_VECTOR vector_t,
+          TLAPACK_SMATRIX matrixT_t>
+int larft_recursive(direction_t direction,
+                    storage_t storeMode,
+                    const matrixV_t& V,
+                    const vector_t& tau,
+                    matrixT_t& T)
+{
+    // data traits
+    using scalar_t = type_t<matrixT_t>;
+    using real_t = real_type<scalar_t>;
+    using idx_t = size_type<matrixV_t>;
+
+    // using
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = (storeMode == StoreV::Columnwise) ? nrows(V) : ncols(V);
+    const idx_t k = size(tau);
+
+    // check arguments
+    tlapack_check_false(direction != Direction::Backward &&
+                        direction != Direction::Forward);
+    tlapack_check_false(storeMode != StoreV::Columnwise &&
+                        storeMode != StoreV::Rowwise);
+    tlapack_check_false(
+        k > ((storeMode == StoreV::Columnwise) ? ncols(V) : nrows(V)));
+    tlapack_check_false(nrows(T) < k || ncols(T) < k);
+    tlapack_check_false(n < k);
+
+    // Quick return
+    if (n == 0 || k == 0) return 0;
+
+    // 1-by-1 case for recursion
+    if (k == 1) {
+        T(0, 0) = tau[0];
+        return 0;
+    }
+
+    const idx_t k1 = k / 2;
+    const idx_t k2 = k - k1;
+    const auto tau1 = slice(tau, range{0, k1});
+    const auto tau2 = slice(tau, range{k1, k});
+    auto T11 = slice(T, range{0, k1}, range{0, k1});
+    auto T22 = slice(T, range{k1, k}, range{k1, k});
+
+    if (direction == Direction::Forward) {
+        // T = [ T11 T12 ]
+        //     [  0  T22 ]
+        auto T12 = slice(T, range{0, k1}, range{k1, k});
+
+        if (storeMode == StoreV::Columnwise) {
+            const auto V1 = slice(V, range{0, n}, range{0, k1});
+            const auto V2 = slice(V, range{k1, n}, range{k1, k});
+            larft_recursive(direction, storeMode, V1, tau1, T11);
+            larft_recursive(direction, storeMode, V2, tau2, T22);
+
+            // T12 := V(k1:k,0:k1)^H V(k1:k,k1:k)
+            for (idx_t j = 0; j < k2; ++j)
+                for (idx_t i = 0; i < k1; ++i)
+                    T12(i, j) = conj(V(k1 + j, i));
+            trmm(RIGHT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one,
+                 slice(V, range{k1, k}, range{k1, k}), T12);
+
+            // T12 := T12 + V(k:n,0:k1)^H V(k:n,k1:k)
+            if (n > k)
+                gemm(CONJ_TRANS, NO_TRANS, one,
+                     slice(V, range{k, n}, range{0, k1}),
+                     slice(V, range{k, n}, range{k1, k}), one, T12);
+        }
+        else {
+            const auto V1 = slice(V, range{0, k1}, range{0, n});
+            const auto V2 = slice(V, range{k1, k}, range{k1, n});
+            larft_recursive(direction, storeMode, V1, tau1, T11);
+            larft_recursive(direction, storeMode, V2, tau2, T22);
+
+            // T12 := V(0:k1,k1:k) V(k1:k,k1:k)^H
+            for (idx_t j = 0; j < k2; ++j)
+                for (idx_t i = 0; i < k1; ++i)
+                    T12(i, j) = V(i, k1 + j);
+            trmm(RIGHT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one,
+                 slice(V, range{k1, k}, range{k1, k}), T12);
+
+            // T12 := T12 + V(0:k1,k:n) V(k1:k,k:n)^H
+            if (n > k)
+                gemm(NO_TRANS, CONJ_TRANS, one,
+                     slice(V, range{0, k1}, range{k, n}),
+                     slice(V, range{k1, k}, range{k, n}), one, T12);
+        }
+
+        // T12 := - T11 T12 T22
+        trmm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, -one, T11,
+             T12);
+        trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, one, T22,
+             T12);
+    }
+    else  // direct==Direction::Backward
+    {
+        // T = [ T11  0  ]
+        //     [ T21 T22 ]
+        auto T21 = slice(T, range{k1, k}, range{0, k1});
+
+        // The unit triangular part of V1 starts at row (or column) p
+        const idx_t p = n - k;
+
+        if (storeMode == StoreV::Columnwise) {
+            const auto V1 = slice(V, range{0, p + k1}, range{0, k1});
+            const auto V2 = slice(V, range{0, n}, range{k1, k});
+            larft_recursive(direction, storeMode, V1, tau1, T11);
+            larft_recursive(direction, storeMode, V2, tau2, T22);
+
+            // T21 := V(p:p+k1,k1:k)^H V(p:p+k1,0:k1)
+            for (idx_t j = 0; j < k1; ++j)
+                for (idx_t i = 0; i < k2; ++i)
+                    T21(i, j) = conj(V(p + j, k1 + i));
+            trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, one,
+                 slice(V, range{p, p + k1}, range{0, k1}), T21);
+
+            // T21 := T21 + V(0:p,k1:k)^H V(0:p,0:k1)
+            if (p > 0)
+                gemm(CONJ_TRANS, NO_TRANS, one,
+                     slice(V, range{0, p}, range{k1, k}),
+                     slice(V, range{0, p}, range{0, k1}), one, T21);
+        }
+        else {
+            const auto V1 = slice(V, range{0, k1}, range{0, p + k1});
+            const auto V2 = slice(V, range{k1, k}, range{0, n});
+            larft_recursive(direction, storeMode, V1, tau1, T11);
+            larft_recursive(direction, storeMode, V2, tau2, T22);
+
+            // T21 := V(k1:k,p:p+k1) V(0:k1,p:p+k1)^H
+            for (idx_t j = 0; j < k1; ++j)
+                for (idx_t i = 0; i < k2; ++i)
+                    T21(i, j) = V(k1 + i, p + j);
+            trmm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one,
+                 slice(V, range{0, k1}, range{p, p + k1}), T21);
+
+            // T21 := T21 + V(k1:k,0:p) V(0:k1,0:p)^H
+            if (p > 0)
+                gemm(NO_TRANS, CONJ_TRANS, one,
+                     slice(V, range{k1, k}, range{0, p}),
+                     slice(V, range{0, k1}, range{0, p}), one, T21);
+        }
+
+        // T21 := - T22 T21 T11
+        trmm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, -one, T22,
+             T21);
+        trmm(RIGHT_SIDE, LOWER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, one, T11,
+             T21);
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LARFT_RECURSIVE_HH
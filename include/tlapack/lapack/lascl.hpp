@@ -14,9 +14,74 @@
 
 #include "tlapack/base/constants.hpp"
 #include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/lacpy.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /** Computes the next multiplication factor c of lascl().
+     *
+     * The scalar a/b is the product of the factors returned by successive
+     * calls, each of which is safe to apply. a_ and b_ are updated with the
+     * remaining numerator and denominator, and done is set to true after the
+     * last factor.
+     *
+     * @ingroup auxiliary
+     */
+    template <class real_t>
+    real_t lascl_factor(real_t& a_, real_t& b_, bool& done)
+    {
+        // constants
+        const real_t small = safe_min<real_t>();
+        const real_t big = safe_max<real_t>();
+
+        real_t c, a1, b1 = b_ * small;
+        if (b1 == b_) {
+            // b is not finite:
+            //  c is a correctly signed zero if a is finite,
+            //  c is NaN otherwise.
+            c = a_ / b_;
+            done = true;
+        }
+        else {  // b is finite
+            a1 = a_ / big;
+            if (a1 == a_) {
+                // a is either 0 or an infinity number:
+                //  in both cases, c = a serves as the correct multiplication
+                //  factor.
+                c = a_;
+                done = true;
+            }
+            else if ((abs(b1) > abs(a_)) && (a_ != real_t(0))) {
+                // a is a non-zero finite number and abs(a/b) < small:
+                //  Set c = small as the multiplication factor,
+                //  Multiply b by the small factor.
+                c = small;
+                done = false;
+                b_ = b1;
+            }
+            else if (abs(a1) > abs(b_)) {
+                // abs(a/b) > big:
+                //  Set c = big as the multiplication factor,
+                //  Divide a by the big factor.
+                c = big;
+                done = false;
+                a_ = a1;
+            }
+            else {
+                // small <= abs(a/b) <= big:
+                //  Set c = a/b as the multiplication factor.
+                c = a_ / b_;
+                done = true;
+            }
+        }
+
+        return c;
+    }
+
+}  // namespace internal
+
 /**
  * @brief Multiplies a matrix A by the real scalar a/b.
  *
@@ -46,7 +111,7 @@ namespace tlapack {
  * @param[in] a The numerator of the scalar a/b.
  * @param[in,out] A Matrix to be scaled by a/b.
  *
- * @return  0 if success..
+ * @return  0 if success.
  *
  * @ingroup auxiliary
  */
@@ -68,9 +133,71 @@ int lascl(uplo_t uplo, const b_type& b, const a_type& a, matrix_t& A)
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
 
+    // check arguments
+    tlapack_check_false(
+        (uplo != Uplo::General) && (uplo != Uplo::UpperHessenberg) &&
+        (uplo != Uplo::LowerHessenberg) && (uplo != Uplo::Upper) &&
+        (uplo != Uplo::Lower) && (uplo != Uplo::StrictUpper) &&
+        (uplo != Uplo::StrictLower));
+    tlapack_check_false((b == b_type(0)) || isnan(b));
+    tlapack_check_false(isnan(a));
+
+    // quick return
+    if (m <= 0 || n <= 0) return 0;
+
+    bool done = false;
+    real_t a_ = a, b_ = b;
+    while (!done) {
+        const real_t c = internal::lascl_factor(a_, b_, done);
+        internal::for_each_entry<layout<matrix_t> == Layout::RowMajor>(
+            Uplo(uplo), m, n, [&](idx_t i, idx_t j) { A(i, j) *= c; });
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Copies the real scalar a/b times a matrix A to B.
+ *
+ * Computes $B := (a/b) A$ in the entries of uplo. The first factor of a/b is
+ * applied while copying, so that A is read only once. If a/b needs more than
+ * one safe factor, the remaining ones are applied to B as in lascl().
+ *
+ * @param[in] uplo Determines the entries of A and B that are referenced.
+ *      @see lascl(uplo_t uplo, const b_type& b, const a_type& a, matrix_t& A)
+ *
+ * @param[in] b The denominator of the scalar a/b.
+ * @param[in] a The numerator of the scalar a/b.
+ * @param[in] A m-by-n matrix.
+ * @param[out] B m-by-n matrix.
+ *
+ * @return  0 if success.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_REAL a_type,
+          TLAPACK_REAL b_type,
+          enable_if_t<(
+                          /* Requires: */
+                          is_real<a_type> && is_real<b_type>),
+                      int> = 0>
+int lascl(uplo_t uplo,
+          const b_type& b,
+          const a_type& a,
+          const matrixA_t& A,
+          matrixB_t& B)
+{
+    // data traits
+    using idx_t = size_type<matrixA_t>;
+    using real_t = real_type<a_type, b_type>;
+
     // constants
-    const real_t small = safe_min<real_t>();
-    const real_t big = safe_max<real_t>();
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    constexpr bool rowMajor = (layout<matrixB_t> == Layout::RowMajor);
 
     // check arguments
     tlapack_check_false(
@@ -80,90 +207,20 @@ int lascl(uplo_t uplo, const b_type& b, const a_type& a, matrix_t& A)
         (uplo != Uplo::StrictLower));
     tlapack_check_false((b == b_type(0)) || isnan(b));
     tlapack_check_false(isnan(a));
+    tlapack_check_false(nrows(B) != m || ncols(B) != n);
 
     // quick return
     if (m <= 0 || n <= 0) return 0;
 
     bool done = false;
     real_t a_ = a, b_ = b;
+    const real_t c0 = internal::lascl_factor(a_, b_, done);
+    internal::for_each_entry<rowMajor>(
+        Uplo(uplo), m, n, [&](idx_t i, idx_t j) { B(i, j) = c0 * A(i, j); });
     while (!done) {
-        real_t c, a1, b1 = b * small;
-        if (b1 == b_) {
-            // b is not finite:
-            //  c is a correctly signed zero if a is finite,
-            //  c is NaN otherwise.
-            c = a_ / b_;
-            done = true;
-        }
-        else {  // b is finite
-            a1 = a_ / big;
-            if (a1 == a_) {
-                // a is either 0 or an infinity number:
-                //  in both cases, c = a serves as the correct multiplication
-                //  factor.
-                c = a_;
-                done = true;
-            }
-            else if ((abs(b1) > abs(a_)) && (a_ != real_t(0))) {
-                // a is a non-zero finite number and abs(a/b) < small:
-                //  Set c = small as the multiplication factor,
-                //  Multiply b by the small factor.
-                c = small;
-                done = false;
-                b_ = b1;
-            }
-            else if (abs(a1) > abs(b_)) {
-                // abs(a/b) > big:
-                //  Set c = big as the multiplication factor,
-                //  Divide a by the big factor.
-                c = big;
-                done = false;
-                a_ = a1;
-            }
-            else {
-                // small <= abs(a/b) <= big:
-                //  Set c = a/b as the multiplication factor.
-                c = a_ / b_;
-                done = true;
-            }
-        }
-
-        if (uplo == Uplo::UpperHessenberg) {
-            for (idx_t j = 0; j < n; ++j)
-                for (idx_t i = 0; i < ((j < m) ? j + 2 : m); ++i)
-                    A(i, j) *= c;
-        }
-        else if (uplo == Uplo::Upper) {
-            for (idx_t j = 0; j < n; ++j)
-                for (idx_t i = 0; i < ((j < m) ? j + 1 : m); ++i)
-                    A(i, j) *= c;
-        }
-        else if (uplo == Uplo::StrictUpper) {
-            for (idx_t j = 0; j < n; ++j)
-                for (idx_t i = 0; i < ((j < m) ? j : m); ++i)
-                    A(i, j) *= c;
-        }
-        else if (uplo == Uplo::LowerHessenberg) {
-            for (idx_t j = 0; j < n; ++j)
-                for (idx_t i = ((j > 1) ? j - 1 : 0); i < m; ++i)
-                    A(i, j) *= c;
-        }
-        else if (uplo == Uplo::Lower) {
-            for (idx_t j = 0; j < n; ++j)
-                for (idx_t i = j; i < m; ++i)
-                    A(i, j) *= c;
-        }
-        else if (uplo == Uplo::StrictLower) {
-            for (idx_t j = 0; j < n; ++j)
-                for (idx_t i = j + 1; i < m; ++i)
-                    A(i, j) *= c;
-        }
-        else  // if ( uplo == Uplo::General )
-        {
-            for (idx_t j = 0; j < n; ++j)
-                for (idx_t i = 0; i < m; ++i)
-                    A(i, j) *= c;
-        }
+        const real_t c = internal::lascl_factor(a_, b_, done);
+        internal::for_each_entry<rowMajor>(
+            Uplo(uplo), m, n, [&](idx_t i, idx_t j) { B(i, j) *= c; });
     }
 
     return 0;
@@ -203,10 +260,6 @@ int lascl(BandAccess accessType, const b_type& b, const a_type& a, matrix_t& A)
     const idx_t kl = accessType.lower_bandwidth;
     const idx_t ku = accessType.upper_bandwidth;
 
-    // constants
-    const real_t small = safe_min<real_t>();
-    const real_t big = safe_max<real_t>();
-
     // check arguments
     tlapack_check_false((kl < 0) || (kl >= m) || (ku < 0) || (ku >= n));
     tlapack_check_false((b == b_type(0)) || isnan(b));
@@ -218,47 +271,7 @@ int lascl(BandAccess accessType, const b_type& b, const a_type& a, matrix_t& A)
     bool done = false;
     real_t a_ = a, b_ = b;
     while (!done) {
-        real_t c, a1, b1 = b * small;
-        if (b1 == b_) {
-            // b is not finite:
-            //  c is a correctly signed zero if a is finite,
-            //  c is NaN otherwise.
-            c = a_ / b_;
-            done = true;
-        }
-        else {  // b is finite
-            a1 = a_ / big;
-            if (a1 == a_) {
-                // a is either 0 or an infinity number:
-                //  in both cases, c = a serves as the correct multiplication
-                //  factor.
-                c = a_;
-                done = true;
-            }
-            else if ((abs(b1) > abs(a_)) && (a_ != real_t(0))) {
-                // a is a non-zero finite number and abs(a/b) < small:
-                //  Set c = small as the multiplication factor,
-                //  Multiply b by the small factor.
-                c = small;
-                done = false;
-                b_ = b1;
-            }
-            else if (abs(a1) > abs(b_)) {
-                // abs(a/b) > big:
-                //  Set c = big as the multiplication factor,
-                //  Divide a by the big factor.
-                c = big;
-                done = false;
-                a_ = a1;
-            }
-            else {
-                // small <= abs(a/b) <= big:
-                //  Set c = a/b as the multiplication factor.
-                c = a_ / b_;
-                done = true;
-            }
-        }
-
+        const real_t c = internal::lascl_factor(a_, b_, done);
         for (idx_t j = 0; j < n; ++j)
             for (idx_t i = ((j >= ku) ? (j - ku) : 0); i < min(m, j + kl + 1);
                  ++i)
@@ -12,13 +12,17 @@
 #ifndef TLAPACK_LASET_HH
 #define TLAPACK_LASET_HH
 
-#include "tlapack/base/types.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/lacpy.hpp"
 
 namespace tlapack {
 
 /**
  * @brief Initializes a matrix to diagonal and off-diagonal values.
  *
+ * The off-diagonal entries are set along the contiguous dimension of A. Large
+ * matrices are set in parallel when TLAPACK_USE_OPENMP is defined.
+ *
  * @tparam uplo_t
  *      Either Uplo or any class that implements `operator Uplo()`.
  *
@@ -50,30 +54,13 @@ void laset(uplo_t uplo,
     tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper &&
                         uplo != Uplo::General);
 
-    if (uplo == Uplo::Upper) {
-        // Set the strictly upper triangular or trapezoidal part of
-        // the array to alpha.
-        for (idx_t j = 1; j < n; ++j) {
-            const idx_t M = min(m, j);
-            for (idx_t i = 0; i < M; ++i)
-                A(i, j) = alpha;
-        }
-    }
-    else if (uplo == Uplo::Lower) {
-        // Set the strictly lower triangular or trapezoidal part of
-        // the array to alpha.
-        const idx_t N = min(m, n);
-        for (idx_t j = 0; j < N; ++j) {
-            for (idx_t i = j + 1; i < m; ++i)
-                A(i, j) = alpha;
-        }
-    }
-    else {
-        // Set all elements in A to alpha.
-        for (idx_t j = 0; j < n; ++j)
-            for (idx_t i = 0; i < m; ++i)
-                A(i, j) = alpha;
-    }
+    // Set the strictly upper or lower triangular or trapezoidal part of A,
+    // or all entries of A, to alpha.
+    const Uplo offdiag = (uplo == Uplo::Upper)   ? Uplo::StrictUpper
+                         : (uplo == Uplo::Lower) ? Uplo::StrictLower
+                                                 : Uplo::General;
+    internal::for_each_entry<layout<matrix_t> == Layout::RowMajor>(
+        offdiag, m, n, [&](idx_t i, idx_t j) { A(i, j) = alpha; });
 
     // Set the first min(m,n) diagonal elements to beta.
     const idx_t N = min(m, n);
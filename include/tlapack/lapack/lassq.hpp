@@ -20,6 +20,151 @@
 
 namespace tlapack {
 
+namespace internal {
+
+    /** Accumulators of the sum of squares in Blue's algorithm.
+     *
+     * The squares are summed in 3 accumulators:
+     *    abig -- sums of squares scaled down to avoid overflow
+     *    asml -- sums of squares scaled up to avoid underflow
+     *    amed -- sums of squares that do not require scaling
+     * The thresholds and multipliers are
+     *    tbig -- values bigger than this are scaled down by sbig
+     *    tsml -- values smaller than this are scaled up by ssml
+     *
+     * Partial sums over disjoint sets of values can be merged, so that the
+     * values can be split among threads. flush() should be called regularly
+     * when many values are added, e.g., after each column of a matrix.
+     *
+     * @ingroup auxiliary
+     */
+    template <class real_t>
+    struct BlueSum {
+        real_t tsml = blue_min<real_t>();
+        real_t tbig = blue_max<real_t>();
+        real_t ssml = blue_scalingMin<real_t>();
+        real_t sbig = blue_scalingMax<real_t>();
+
+        real_t asml = real_t(0);
+        real_t amed = real_t(0);
+        real_t abig = real_t(0);
+
+        /// Adds ax^2 to the sum, where ax >= 0
+        constexpr void add(const real_t& ax) noexcept
+        {
+            if (ax > tbig)
+                abig += (ax * sbig) * (ax * sbig);
+            else if (ax < tsml) {
+                if (abig == real_t(0)) asml += (ax * ssml) * (ax * ssml);
+            }
+            else
+                amed += ax * ax;
+        }
+
+        /// Moves amed to abig if it is large, so that amed does not overflow
+        /// when more values are added
+        constexpr void flush() noexcept
+        {
+            if (amed >= tbig * tbig) {
+                abig += (amed * sbig) * sbig;
+                amed = real_t(0);
+            }
+        }
+
+        /// Adds the partial sum of squares in other
+        constexpr void merge(const BlueSum& other) noexcept
+        {
+            asml += other.asml;
+            amed += other.amed;
+            abig += other.abig;
+            flush();
+        }
+
+        /** Adds the sum to scale^2 sumsq, and overwrites scale and sumsq with
+         * the result in scaled form. scale and sumsq are assumed to be
+         * normalized as in lassq().
+         */
+        void finalize(real_t& scale, real_t& sumsq)
+        {
+            const real_t zero(0);
+            const real_t one(1);
+
+            // Put the existing sum of squares into one of the accumulators
+            if (sumsq > zero) {
+                real_t ax = scale * sqrt(sumsq);
+                if (ax > tbig) {
+                    if (scale > one) {
+                        scale *= sbig;
+                        abig += scale * (scale * sumsq);
+                    }
+                    else {
+                        // sumsq > tbig^2 => (sbig * (sbig * sumsq)) is
+                        // representable
+                        abig += scale * (scale * (sbig * (sbig * sumsq)));
+                    }
+                }
+                else if (ax < tsml) {
+                    if (abig == zero) {
+                        if (scale < one) {
+                            scale *= ssml;
+                            asml += scale * (scale * sumsq);
+                        }
+                        else {
+                            // sumsq < tsml^2 => (ssml * (ssml * sumsq)) is
+                            // representable
+                            asml += scale * (scale * (ssml * (ssml * sumsq)));
+                        }
+                    }
+                }
+                else {
+                    amed += scale * (scale * sumsq);
+                }
+            }
+
+            // Combine abig and amed or amed and asml if
+            // more than one accumulator was used.
+
+            if (abig > zero) {
+                // Combine abig and amed if abig > 0
+                if (amed > zero || isnan(amed)) abig += (amed * sbig) * sbig;
+                scale = one / sbig;
+                sumsq = abig;
+            }
+            else if (asml > zero) {
+                // Combine amed and asml if asml > 0
+                if (amed > zero || isnan(amed)) {
+                    amed = sqrt(amed);
+                    asml = sqrt(asml) / ssml;
+
+                    real_t ymin, ymax;
+                    if (asml > amed) {
+                        ymin = amed;
+                        ymax = asml;
+                    }
+                    else {
+                        ymin = asml;
+                        ymax = amed;
+                    }
+
+                    scale = one;
+                    sumsq =
+                        (ymax * ymax) * (one + (ymin / ymax) * (ymin / ymax));
+                }
+                else {
+                    scale = one / ssml;
+                    sumsq = asml;
+                }
+            }
+            else {
+                // Otherwise all values are mid-range or zero
+                scale = one;
+                sumsq = amed;
+            }
+        }
+    };
+
+}  // namespace internal
+
 /** Updates a sum of squares represented in scaled form.
  * \[
  *      scl smsq := \sum_{i = 0}^n |x_i|^2 + scale^2 sumsq,
@@ -60,10 +205,6 @@ void lassq(const vector_t& x,
     // constants
     const real_t zero(0);
     const real_t one(1);
-    const real_t tsml = blue_min<real_t>();
-    const real_t tbig = blue_max<real_t>();
-    const real_t ssml = blue_scalingMin<real_t>();
-    const real_t sbig = blue_scalingMax<real_t>();
 
     // quick return
     if (isnan(scale) || isnan(sumsq)) return;
@@ -77,98 +218,11 @@ void lassq(const vector_t& x,
     // quick return
     if (n <= 0) return;
 
-    //  Compute the sum of squares in 3 accumulators:
-    //     abig -- sums of squares scaled down to avoid overflow
-    //     asml -- sums of squares scaled up to avoid underflow
-    //     amed -- sums of squares that do not require scaling
-    //  The thresholds and multipliers are
-    //     tbig -- values bigger than this are scaled down by sbig
-    //     tsml -- values smaller than this are scaled up by ssml
-
-    real_t asml = zero;
-    real_t amed = zero;
-    real_t abig = zero;
-
-    for (idx_t i = 0; i < n; ++i) {
-        real_t ax = absF(x[i]);
-        if (ax > tbig)
-            abig += (ax * sbig) * (ax * sbig);
-        else if (ax < tsml) {
-            if (abig == zero) asml += (ax * ssml) * (ax * ssml);
-        }
-        else
-            amed += ax * ax;
-    }
-
-    // Put the existing sum of squares into one of the accumulators
-    if (sumsq > zero) {
-        real_t ax = scale * sqrt(sumsq);
-        if (ax > tbig) {
-            if (scale > one) {
-                scale *= sbig;
-                abig += scale * (scale * sumsq);
-            }
-            else {
-                // sumsq > tbig^2 => (sbig * (sbig * sumsq)) is representable
-                abig += scale * (scale * (sbig * (sbig * sumsq)));
-            }
-        }
-        else if (ax < tsml) {
-            if (abig == zero) {
-                if (scale < one) {
-                    scale *= ssml;
-                    asml += scale * (scale * sumsq);
-                }
-                else {
-                    // sumsq < tsml^2 => (ssml * (ssml * sumsq)) is
-                    // representable
-                    asml += scale * (scale * (ssml * (ssml * sumsq)));
-                }
-            }
-        }
-        else {
-            amed += scale * (scale * sumsq);
-        }
-    }
-
-    // Combine abig and amed or amed and asml if
-    // more than one accumulator was used.
-
-    if (abig > zero) {
-        // Combine abig and amed if abig > 0
-        if (amed > zero || isnan(amed)) abig += (amed * sbig) * sbig;
-        scale = one / sbig;
-        sumsq = abig;
-    }
-    else if (asml > zero) {
-        // Combine amed and asml if asml > 0
-        if (amed > zero || isnan(amed)) {
-            amed = sqrt(amed);
-            asml = sqrt(asml) / ssml;
-
-            real_t ymin, ymax;
-            if (asml > amed) {
-                ymin = amed;
-                ymax = asml;
-            }
-            else {
-                ymin = asml;
-                ymax = amed;
-            }
-
-            scale = one;
-            sumsq = (ymax * ymax) * (one + (ymin / ymax) * (ymin / ymax));
-        }
-        else {
-            scale = one / ssml;
-            sumsq = asml;
-        }
-    }
-    else {
-        // Otherwise all values are mid-range or zero
-        scale = one;
-        sumsq = amed;
-    }
+    //  Compute the sum of squares in the 3 accumulators of Blue's algorithm
+    internal::BlueSum<real_t> acc;
+    for (idx_t i = 0; i < n; ++i)
+        acc.add(absF(x[i]));
+    acc.finalize(scale, sumsq);
 }
 
 /** Updates a sum of squares represented in scaled form.
@@ -0,0 +1,207 @@
+/// @file latrd.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zlatrd.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LATRD_HH
+#define TLAPACK_LATRD_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/axpy.hpp"
+#include "tlapack/blas/dot.hpp"
+#include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/hemv.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/conjugate.hpp"
+#include "tlapack/lapack/larfg.hpp"
+
+namespace tlapack {
+
+/** Reduces nb rows and columns of a Hermitian matrix A to real tridiagonal
+ * form by a unitary similarity transformation Q**H * A * Q, and returns the
+ * matrix W which is needed to apply the transformation to the unreduced part
+ * of A.
+ *
+ * If uplo = Uplo::Upper, the last nb columns of A are reduced; if
+ * uplo = Uplo::Lower, the first nb columns are reduced. The unreduced part
+ * of A is then updated by hetrd() as
+ * \[
+ *          A := A - V * W**H - W * V**H,
+ * \]
+ * where V holds the elementary reflectors.
+ *
+ * The off-diagonal elements of the tridiagonal matrix are stored in A, as in
+ * hetd2(). When updating the unreduced part of A, the caller must set the
+ * unit element of the last reflector in V to one.
+ *
+ * This is an auxiliary routine called by hetrd
+ *
+ * @return  0 if success
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *
+ * @param[out] tau vector of length n-1.
+ *      - If uplo = Uplo::Upper, tau[n-nb-1:n-1] contains the scalar factors
+ *        of the elementary reflectors of the last nb columns;
+ *      - If uplo = Uplo::Lower, tau[0:nb] contains the scalar factors of the
+ *        elementary reflectors of the first nb columns.
+ *
+ * @param[out] W n-by-nb matrix.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX A_t,
+          TLAPACK_VECTOR vector_t,
+          TLAPACK_SMATRIX W_t>
+int latrd(uplo_t uplo, A_t& A, vector_t& tau, W_t& W)
+{
+    using TA = type_t<A_t>;
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<TA>;
+
+    // constants
+    const real_t one(1);
+    const real_t zero(0);
+    const real_t half(0.5);
+    const idx_t n = nrows(A);
+    const idx_t nb = ncols(W);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(ncols(A) == n);
+    tlapack_check(nrows(W) == n);
+    tlapack_check(nb <= n);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    if (uplo == Uplo::Upper) {
+        // Reduce last nb columns of upper triangle
+        for (idx_t i = n; i-- > n - nb;) {
+            const idx_t iw = i - (n - nb);
+            if (i < n - 1) {
+                // Update A(0:i+1, i)
+                A(i, i) = real(A(i, i));
+                const TA ei = A(i, i + 1);
+                A(i, i + 1) = one;
+
+                auto a = slice(A, range{0, i + 1}, i);
+                auto A12 = slice(A, range{0, i + 1}, range{i + 1, n});
+                auto W12 = slice(W, range{0, i + 1}, range{iw + 1, nb});
+                auto wi = slice(W, i, range{iw + 1, nb});
+                auto ai = slice(A, i, range{i + 1, n});
+
+                conjugate(wi);
+                gemv(NO_TRANS, -one, A12, wi, one, a);
+                conjugate(wi);
+                conjugate(ai);
+                gemv(NO_TRANS, -one, W12, ai, one, a);
+                conjugate(ai);
+
+                A(i, i + 1) = ei;
+                A(i, i) = real(A(i, i));
+            }
+            if (i > 0) {
+                // Generate elementary reflector H(i-1) to annihilate
+                // A(0:i-1, i)
+                auto v = slice(A, range{0, i}, i);
+                larfg(BACKWARD, COLUMNWISE_STORAGE, v, tau[i - 1]);
+                const TA ei = A(i - 1, i);
+                A(i - 1, i) = one;
+
+                // Compute W(0:i, iw)
+                auto w = slice(W, range{0, i}, iw);
+                hemv(UPPER_TRIANGLE, one, slice(A, range{0, i}, range{0, i}),
+                     v, zero, w);
+                if (i < n - 1) {
+                    auto wt = slice(W, range{i + 1, n}, iw);
+                    auto A02 = slice(A, range{0, i}, range{i + 1, n});
+                    auto W02 = slice(W, range{0, i}, range{iw + 1, nb});
+
+                    gemv(CONJ_TRANS, one, W02, v, zero, wt);
+                    gemv(NO_TRANS, -one, A02, wt, one, w);
+                    gemv(CONJ_TRANS, one, A02, v, zero, wt);
+                    gemv(NO_TRANS, -one, W02, wt, one, w);
+                }
+                scal(tau[i - 1], w);
+                const TA alpha = -half * tau[i - 1] * dot(w, v);
+                axpy(alpha, v, w);
+
+                A(i - 1, i) = ei;
+            }
+        }
+    }
+    else {
+        // Reduce first nb columns of lower triangle
+        for (idx_t i = 0; i < nb; ++i) {
+            if (i > 0) {
+                // Update A(i:n, i)
+                A(i, i) = real(A(i, i));
+                const TA ei = A(i, i - 1);
+                A(i, i - 1) = one;
+
+                auto a = slice(A, range{i, n}, i);
+                auto A10 = slice(A, range{i, n}, range{0, i});
+                auto W10 = slice(W, range{i, n}, range{0, i});
+                auto wi = slice(W, i, range{0, i});
+                auto ai = slice(A, i, range{0, i});
+
+                conjugate(wi);
+                gemv(NO_TRANS, -one, A10, wi, one, a);
+                conjugate(wi);
+                conjugate(ai);
+                gemv(NO_TRANS, -one, W10, ai, one, a);
+                conjugate(ai);
+
+                A(i, i - 1) = ei;
+                A(i, i) = real(A(i, i));
+            }
+            if (i < n - 1) {
+                // Generate elementary reflector H(i) to annihilate
+                // A(i+2:n, i)
+                auto v = slice(A, range{i + 1, n}, i);
+                larfg(FORWARD, COLUMNWISE_STORAGE, v, tau[i]);
+                const TA ei = A(i + 1, i);
+                A(i + 1, i) = one;
+
+                // Compute W(i+1:n, i)
+                auto w = slice(W, range{i + 1, n}, i);
+                hemv(LOWER_TRIANGLE, one,
+                     slice(A, range{i + 1, n}, range{i + 1, n}), v, zero, w);
+                if (i > 0) {
+                    auto wt = slice(W, range{0, i}, i);
+                    auto A20 = slice(A, range{i + 1, n}, range{0, i});
+                    auto W20 = slice(W, range{i + 1, n}, range{0, i});
+
+                    gemv(CONJ_TRANS, one, W20, v, zero, wt);
+                    gemv(NO_TRANS, -one, A20, wt, one, w);
+                    gemv(CONJ_TRANS, one, A20, v, zero, wt);
+                    gemv(NO_TRANS, -one, W20, wt, one, w);
+                }
+                scal(tau[i], w);
+                const TA alpha = -half * tau[i] * dot(w, v);
+                axpy(alpha, v, w);
+
+                A(i + 1, i) = ei;
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LATRD_HH
@@ -15,6 +15,7 @@
 #include "tlapack/lapack/lahqr_shiftcolumn.hpp"
 #include "tlapack/lapack/larfg.hpp"
 #include "tlapack/lapack/move_bulge.hpp"
+#include "tlapack/lapack/qz_offwindow_update.hpp"
 
 namespace tlapack {
 
@@ -105,13 +106,18 @@ void multishift_QZ_sweep(bool want_t,
     // workspace, they are not needed at the same time)
     auto v = slice(A, range(n - 3, n), n_block_desired);
 
-    // Workspace for horizontal multiplications
-    auto WH = slice(A, range{n - n_block_desired, n},
-                    range{n_block_desired, n - n_block_desired - 3});
+    // Workspace for horizontal multiplications. A and B have their own
+    // buffers, so that their updates are independent.
+    auto WHA = slice(A, range{n - n_block_desired, n},
+                     range{n_block_desired, n - n_block_desired - 3});
+    auto WHB = slice(B, range{n - n_block_desired, n},
+                     range{n_block_desired, n - n_block_desired - 3});
 
     // Workspace for vertical multiplications
-    auto WV = slice(A, range{n_block_desired + 3, n - n_block_desired},
-                    range{0, n_block_desired});
+    auto WVA = slice(A, range{n_block_desired + 3, n - n_block_desired},
+                     range{0, n_block_desired});
+    auto WVB = slice(B, range{n_block_desired + 3, n - n_block_desired},
+                     range{0, n_block_desired});
 
     // Position of the shift train in the pencil.
     idx_t i_pos_block;
@@ -275,88 +281,8 @@ void multishift_QZ_sweep(bool want_t,
             istart_m = ilo;
             istop_m = ihi;
         }
-        // Update A
-        if (ilo + n_shifts + 1 < istop_m) {
-            idx_t i = ilo + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-                auto A_slice =
-                    slice(A, range{ilo, ilo + n_block}, range{i, i + iblock});
-                auto WH_slice = slice(WH, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(CONJ_TRANS, NO_TRANS, one, Qc2, A_slice, WH_slice);
-                lacpy(GENERAL, WH_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        if (istart_m < ilo) {
-            idx_t i = istart_m;
-            while (i < ilo) {
-                idx_t iblock = std::min<idx_t>(ilo - i, nrows(WV));
-                auto A_slice =
-                    slice(A, range{i, i + iblock}, range{ilo, ilo + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, A_slice, Zc2, WV_slice);
-                lacpy(GENERAL, WV_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        // Update B
-        if (ilo + n_shifts + 1 < istop_m) {
-            idx_t i = ilo + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-                auto B_slice =
-                    slice(B, range{ilo, ilo + n_block}, range{i, i + iblock});
-                auto WH_slice = slice(WH, range{0, nrows(B_slice)},
-                                      range{0, ncols(B_slice)});
-                gemm(CONJ_TRANS, NO_TRANS, one, Qc2, B_slice, WH_slice);
-                lacpy(GENERAL, WH_slice, B_slice);
-                i = i + iblock;
-            }
-        }
-        if (istart_m < ilo) {
-            idx_t i = istart_m;
-            while (i < ilo) {
-                idx_t iblock = std::min<idx_t>(ilo - i, nrows(WV));
-                auto B_slice =
-                    slice(B, range{i, i + iblock}, range{ilo, ilo + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(B_slice)},
-                                      range{0, ncols(B_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, B_slice, Zc2, WV_slice);
-                lacpy(GENERAL, WV_slice, B_slice);
-                i = i + iblock;
-            }
-        }
-        // Update Q
-        if (want_q) {
-            idx_t i = 0;
-            while (i < n) {
-                idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-                auto Q_slice =
-                    slice(Q, range{i, i + iblock}, range{ilo, ilo + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(Q_slice)},
-                                      range{0, ncols(Q_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, Q_slice, Qc2, WV_slice);
-                lacpy(GENERAL, WV_slice, Q_slice);
-                i = i + iblock;
-            }
-        }
-        // Update Z
-        if (want_z) {
-            idx_t i = 0;
-            while (i < n) {
-                idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-                auto Z_slice =
-                    slice(Z, range{i, i + iblock}, range{ilo, ilo + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(Z_slice)},
-                                      range{0, ncols(Z_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, Z_slice, Zc2, WV_slice);
-                lacpy(GENERAL, WV_slice, Z_slice);
-                i = i + iblock;
-            }
-        }
+        qz_offwindow_update(want_q, want_z, istart_m, istop_m, ilo, ilo, A, B,
+                            Q, Z, Qc2, Zc2, WHA, WHB, WVA, WVB);
 
         i_pos_block = ilo + n_block - n_shifts - 1;
     }
@@ -485,91 +411,9 @@ void multishift_QZ_sweep(bool want_t,
             istart_m = ilo;
             istop_m = ihi;
         }
-        // Update A
-        if (i_pos_block + n_block < istop_m) {
-            idx_t i = i_pos_block + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-                auto A_slice =
-                    slice(A, range{i_pos_block + 1, i_pos_block + 1 + n_block},
-                          range{i, i + iblock});
-                auto WH_slice = slice(WH, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(CONJ_TRANS, NO_TRANS, one, Qc2, A_slice, WH_slice);
-                lacpy(GENERAL, WH_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        if (istart_m < i_pos_block) {
-            idx_t i = istart_m;
-            while (i < i_pos_block) {
-                idx_t iblock = std::min<idx_t>(i_pos_block - i, nrows(WV));
-                auto A_slice = slice(A, range{i, i + iblock},
-                                     range{i_pos_block, i_pos_block + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, A_slice, Zc2, WV_slice);
-                lacpy(GENERAL, WV_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        // Update B
-        if (i_pos_block + n_block < istop_m) {
-            idx_t i = i_pos_block + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-                auto B_slice =
-                    slice(B, range{i_pos_block + 1, i_pos_block + 1 + n_block},
-                          range{i, i + iblock});
-                auto WH_slice = slice(WH, range{0, nrows(B_slice)},
-                                      range{0, ncols(B_slice)});
-                gemm(CONJ_TRANS, NO_TRANS, one, Qc2, B_slice, WH_slice);
-                lacpy(GENERAL, WH_slice, B_slice);
-                i = i + iblock;
-            }
-        }
-        if (istart_m < i_pos_block) {
-            idx_t i = istart_m;
-            while (i < i_pos_block) {
-                idx_t iblock = std::min<idx_t>(i_pos_block - i, nrows(WV));
-                auto B_slice = slice(B, range{i, i + iblock},
-                                     range{i_pos_block, i_pos_block + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(B_slice)},
-                                      range{0, ncols(B_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, B_slice, Zc2, WV_slice);
-                lacpy(GENERAL, WV_slice, B_slice);
-                i = i + iblock;
-            }
-        }
-        // Update Q
-        if (want_q) {
-            idx_t i = 0;
-            while (i < n) {
-                idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-                auto Q_slice =
-                    slice(Q, range{i, i + iblock},
-                          range{i_pos_block + 1, i_pos_block + 1 + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(Q_slice)},
-                                      range{0, ncols(Q_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, Q_slice, Qc2, WV_slice);
-                lacpy(GENERAL, WV_slice, Q_slice);
-                i = i + iblock;
-            }
-        }
-        // Update Z
-        if (want_z) {
-            idx_t i = 0;
-            while (i < n) {
-                idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-                auto Z_slice = slice(Z, range{i, i + iblock},
-                                     range{i_pos_block, i_pos_block + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(Z_slice)},
-                                      range{0, ncols(Z_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, Z_slice, Zc2, WV_slice);
-                lacpy(GENERAL, WV_slice, Z_slice);
-                i = i + iblock;
-            }
-        }
+        qz_offwindow_update(want_q, want_z, istart_m, istop_m,
+                            i_pos_block + 1, i_pos_block, A, B, Q, Z, Qc2, Zc2,
+                            WHA, WHB, WVA, WVB);
 
         i_pos_block = i_pos_block + n_pos;
     }
@@ -758,90 +602,9 @@ void multishift_QZ_sweep(bool want_t,
             istart_m = ilo;
             istop_m = ihi;
         }
-        // Update A
-        if (i_pos_block + n_block < istop_m) {
-            idx_t i = i_pos_block + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-                auto A_slice =
-                    slice(A, range{i_pos_block, i_pos_block + n_block},
-                          range{i, i + iblock});
-                auto WH_slice = slice(WH, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(CONJ_TRANS, NO_TRANS, one, Qc2, A_slice, WH_slice);
-                lacpy(GENERAL, WH_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        if (istart_m < i_pos_block) {
-            idx_t i = istart_m;
-            while (i < i_pos_block) {
-                idx_t iblock = std::min<idx_t>(i_pos_block - i, nrows(WV));
-                auto A_slice = slice(A, range{i, i + iblock},
-                                     range{i_pos_block, i_pos_block + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, A_slice, Zc2, WV_slice);
-                lacpy(GENERAL, WV_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        // Update B
-        if (i_pos_block + n_block < istop_m) {
-            idx_t i = i_pos_block + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-                auto B_slice =
-                    slice(B, range{i_pos_block, i_pos_block + n_block},
-                          range{i, i + iblock});
-                auto WH_slice = slice(WH, range{0, nrows(B_slice)},
-                                      range{0, ncols(B_slice)});
-                gemm(CONJ_TRANS, NO_TRANS, one, Qc2, B_slice, WH_slice);
-                lacpy(GENERAL, WH_slice, B_slice);
-                i = i + iblock;
-            }
-        }
-        if (istart_m < i_pos_block) {
-            idx_t i = istart_m;
-            while (i < i_pos_block) {
-                idx_t iblock = std::min<idx_t>(i_pos_block - i, nrows(WV));
-                auto B_slice = slice(B, range{i, i + iblock},
-                                     range{i_pos_block, i_pos_block + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(B_slice)},
-                                      range{0, ncols(B_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, B_slice, Zc2, WV_slice);
-                lacpy(GENERAL, WV_slice, B_slice);
-                i = i + iblock;
-            }
-        }
-        // Update Q
-        if (want_q) {
-            idx_t i = 0;
-            while (i < n) {
-                idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-                auto Q_slice = slice(Q, range{i, i + iblock},
-                                     range{i_pos_block, i_pos_block + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(Q_slice)},
-                                      range{0, ncols(Q_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, Q_slice, Qc2, WV_slice);
-                lacpy(GENERAL, WV_slice, Q_slice);
-                i = i + iblock;
-            }
-        }
-        // Update Z
-        if (want_z) {
-            idx_t i = 0;
-            while (i < n) {
-                idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-                auto Z_slice = slice(Z, range{i, i + iblock},
-                                     range{i_pos_block, i_pos_block + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(Z_slice)},
-                                      range{0, ncols(Z_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, Z_slice, Zc2, WV_slice);
-                lacpy(GENERAL, WV_slice, Z_slice);
-                i = i + iblock;
-            }
-        }
+        qz_offwindow_update(want_q, want_z, istart_m, istop_m, i_pos_block,
+                            i_pos_block, A, B, Q, Z, Qc2, Zc2, WHA, WHB, WVA,
+                            WVB);
     }
 }
 
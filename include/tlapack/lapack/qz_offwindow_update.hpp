@@ -0,0 +1,175 @@
+/// @file qz_offwindow_update.hpp
+/// @author Thijs Steel, KU Leuven, Belgium
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_QZ_OFFWINDOW_UPDATE_HH
+#define TLAPACK_QZ_OFFWINDOW_UPDATE_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+
+namespace tlapack {
+
+/** qz_offwindow_update applies the unitary transformations accumulated on a
+ *  diagonal window of the pencil (A,B) to the rest of the pencil and to the
+ *  Schur vectors.
+ *
+ *  Let k = ncols(Qc), WQ = kq:kq+k and WZ = kz:kz+k. The rows WQ and the
+ *  columns WZ of the pencil are the ones transformed inside the window. This
+ *  routine computes
+ *
+ *      A(WQ, kz+k:istop_m) = Qc**H * A(WQ, kz+k:istop_m),
+ *      B(WQ, kz+k:istop_m) = Qc**H * B(WQ, kz+k:istop_m),
+ *      A(istart_m:kz, WZ) = A(istart_m:kz, WZ) * Zc,
+ *      B(istart_m:kz, WZ) = B(istart_m:kz, WZ) * Zc,
+ *      Q(:, WQ) = Q(:, WQ) * Qc, if want_q, and
+ *      Z(:, WZ) = Z(:, WZ) * Zc, if want_z,
+ *
+ *  using matrix-matrix multiplications on blocks that fit the buffers. The
+ *  updates of A and B use separate buffers, so that the four groups
+ *
+ *      - rows WQ of A,
+ *      - rows WQ of B,
+ *      - columns WZ of A and columns WQ of Q,
+ *      - columns WZ of B and of Z,
+ *
+ *  are independent. They run in parallel when <T>LAPACK is built with
+ *  TLAPACK_USE_OPENMP.
+ *
+ * @param[in] want_q bool.
+ *      If true, the transformation Qc is applied to Q.
+ *
+ * @param[in] want_z bool.
+ *      If true, the transformation Zc is applied to Z.
+ *
+ * @param[in] istart_m integer.
+ *      First row of A and B that is updated from the right.
+ *
+ * @param[in] istop_m integer.
+ *      A and B are updated from the left up to column istop_m.
+ *
+ * @param[in] kq integer.
+ *      First row of the window that is transformed from the left.
+ *
+ * @param[in] kz integer.
+ *      First column of the window that is transformed from the right.
+ *
+ * @param[in,out] A n by n matrix.
+ * @param[in,out] B n by n matrix.
+ * @param[in,out] Q n by n matrix.
+ * @param[in,out] Z n by n matrix.
+ *
+ * @param[in] Qc k by k matrix.
+ *      Left unitary transformation accumulated on the window.
+ *
+ * @param[in] Zc k by k matrix.
+ *      Right unitary transformation accumulated on the window.
+ *
+ * @param WHA Workspace with k rows for the updates of A from the left.
+ * @param WHB Workspace with k rows for the updates of B from the left.
+ * @param WVA Workspace with k columns for the updates of A and Q from the
+ *      right.
+ * @param WVB Workspace with k columns for the updates of B and Z from the
+ *      right.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SMATRIX Qc_t,
+          TLAPACK_SMATRIX Zc_t,
+          TLAPACK_SMATRIX work_t>
+void qz_offwindow_update(bool want_q,
+                         bool want_z,
+                         size_type<matrix_t> istart_m,
+                         size_type<matrix_t> istop_m,
+                         size_type<matrix_t> kq,
+                         size_type<matrix_t> kz,
+                         matrix_t& A,
+                         matrix_t& B,
+                         matrix_t& Q,
+                         matrix_t& Z,
+                         const Qc_t& Qc,
+                         const Zc_t& Zc,
+                         work_t& WHA,
+                         work_t& WHB,
+                         work_t& WVA,
+                         work_t& WVB)
+{
+    using TA = type_t<matrix_t>;
+    using real_t = real_type<TA>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    const real_t one(1);
+    const idx_t n = ncols(A);
+    const idx_t k = ncols(Qc);
+    const range wq(kq, kq + k);
+    const range wz(kz, kz + k);
+
+    // check arguments
+    tlapack_check(nrows(WHA) >= k && nrows(WHB) >= k);
+    tlapack_check(ncols(WVA) >= k && ncols(WVB) >= k);
+
+    // Computes M(wq, kz+k:istop_m) = Qc**H * M(wq, kz+k:istop_m)
+    auto update_rows = [&](matrix_t& M, work_t& WH) {
+        const idx_t nb = ncols(WH);
+        for (idx_t j = kz + k; j < istop_m; j += nb) {
+            const idx_t jb = min(nb, istop_m - j);
+            auto M_slice = slice(M, wq, range{j, j + jb});
+            auto WH_slice = slice(WH, range{0, k}, range{0, jb});
+            gemm(CONJ_TRANS, NO_TRANS, one, Qc, M_slice, WH_slice);
+            lacpy(GENERAL, WH_slice, M_slice);
+        }
+    };
+
+    // Computes M(i0:i1, w) = M(i0:i1, w) * V
+    auto update_cols = [&](matrix_t& M, const auto& V, const range& w,
+                           idx_t i0, idx_t i1, work_t& WV) {
+        const idx_t nb = nrows(WV);
+        for (idx_t i = i0; i < i1; i += nb) {
+            const idx_t ib = min(nb, i1 - i);
+            auto M_slice = slice(M, range{i, i + ib}, w);
+            auto WV_slice = slice(WV, range{0, ib}, range{0, k});
+            gemm(NO_TRANS, NO_TRANS, one, M_slice, V, WV_slice);
+            lacpy(GENERAL, WV_slice, M_slice);
+        }
+    };
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel sections
+#endif
+    {
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp section
+#endif
+        update_rows(A, WHA);
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp section
+#endif
+        update_rows(B, WHB);
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp section
+#endif
+        {
+            update_cols(A, Zc, wz, istart_m, kz, WVA);
+            if (want_q) update_cols(Q, Qc, wq, 0, n, WVA);
+        }
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp section
+#endif
+        {
+            update_cols(B, Zc, wz, istart_m, kz, WVB);
+            if (want_z) update_cols(Z, Zc, wz, 0, n, WVB);
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_QZ_OFFWINDOW_UPDATE_HH
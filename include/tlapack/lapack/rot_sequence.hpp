@@ -17,6 +17,60 @@
 
 namespace tlapack {
 
+namespace internal {
+
+    /** Applies a reflector of order 3 followed by a plane rotation to the
+     * columns of an m-by-3 matrix
+     *
+     *     A := A * H * P**H,
+     *
+     * where H = I - tau v v**H with v = (1, v2, v3), and P is the rotation
+     * of rot_sequence() with cosine c and sine s acting on the columns 1
+     * and 2 of A. Each row of A is loaded and stored once for both
+     * transformations.
+     *
+     * @param[in,out] A m-by-3 matrix.
+     * @param[in] v2 Second entry of v.
+     * @param[in] v3 Third entry of v.
+     * @param[in] tau Scalar factor of H.
+     * @param[in] c Cosine of the rotation.
+     * @param[in] s Sine of the rotation.
+     *
+     * @ingroup auxiliary
+     */
+    template <TLAPACK_SMATRIX A_t,
+              TLAPACK_SCALAR TV,
+              TLAPACK_REAL real_t,
+              TLAPACK_SCALAR TS>
+    void larf3_rot(A_t& A,
+                   const TV& v2,
+                   const TV& v3,
+                   const TV& tau,
+                   const real_t& c,
+                   const TS& s)
+    {
+        using T = type_t<A_t>;
+        using idx_t = size_type<A_t>;
+
+        // constants
+        const idx_t m = nrows(A);
+        const T t2 = tau * conj(v2);
+        const T t3 = tau * conj(v3);
+
+        tlapack_check(ncols(A) == 3);
+
+        for (idx_t j = 0; j < m; ++j) {
+            const T sum = A(j, 0) + v2 * A(j, 1) + v3 * A(j, 2);
+            const T a1 = A(j, 1) - sum * t2;
+            const T a2 = A(j, 2) - sum * t3;
+            A(j, 0) = A(j, 0) - sum * tau;
+            A(j, 1) = c * a1 + conj(s) * a2;
+            A(j, 2) = c * a2 - s * a1;
+        }
+    }
+
+}  // namespace internal
+
 /** Applies a sequence of plane rotations to an (m-by-n) matrix
  *
  * When side = Side::Left, the transformation takes the form
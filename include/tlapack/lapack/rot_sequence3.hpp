@@ -0,0 +1,174 @@
+/// @file rot_sequence3.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @note Based on the wavefront algorithm in @see
+/// F. G. Van Zee, R. A. van de Geijn, G. Quintana-Orti. Restructuring the
+/// Tridiagonal and Bidiagonal QR Algorithms for Performance. ACM Trans. Math.
+/// Softw. 40, 3, Article 18 (2014).
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_ROT_SEQUENCE3_HH
+#define TLAPACK_ROT_SEQUENCE3_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for rot_sequence3
+ */
+struct RotSequence3Opts {
+    /// Number of rows of A (columns of A if side = Side::Left) that are
+    /// updated together by all rotations
+    size_t nb = 64;
+};
+
+/** Applies l sequences of plane rotations to an (m-by-n) matrix
+ *
+ * Applies the sequences defined by the columns of C and S one after the
+ * other, starting with the first column. Each sequence is applied as in
+ * rot_sequence(),
+ *
+ *     A := P_j A  if side = Side::Left, or
+ *     A := A P_j**H  if side = Side::Right,
+ *
+ * where P_j is the product of the k plane rotations (C(i,j), S(i,j)),
+ * i = 0, ..., k-1, in the order given by direction.
+ *
+ * The rotations are applied in a wavefront pattern: rotation i of sequence j
+ * is applied at step q + 2j, where q is the position of rotation i in its
+ * sequence. Rotations at the same step act on disjoint pairs of rows (or
+ * columns), so all l sequences are applied with one sweep over A. When the
+ * entries of A that each rotation updates are contiguous in memory, A is
+ * updated in slabs of opts.nb vectors that stay in cache while all rotations
+ * are applied. The slabs are independent and are updated in parallel when
+ * TLAPACK_USE_OPENMP is defined. Identity rotations, with c = 1 and s = 0,
+ * are skipped, so sequences that only act on part of A can be padded with
+ * them.
+ *
+ * @return  0 if success
+ *
+ * @param[in] side
+ *      Specifies whether the plane rotation matrices are applied to A
+ *      on the left or the right
+ *      - Side::Left:  A := P * A;
+ *      - Side::Right: A := A * P**H.
+ *
+ * @param[in] direction
+ *     Specifies whether each P_j is a forward or backward sequence of plane
+ *     rotations. @see rot_sequence()
+ *
+ * @param[in] C Real k-by-l matrix.
+ *     Cosines of the rotations. k = m-1 if side = Side::Left and k = n-1 if
+ *     side = Side::Right.
+ *
+ * @param[in] S k-by-l matrix.
+ *     Sines of the rotations
+ *
+ * @param[in,out] A m-by-n matrix.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Size of the slabs of A.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SIDE side_t,
+          TLAPACK_DIRECTION direction_t,
+          TLAPACK_SMATRIX C_t,
+          TLAPACK_SMATRIX S_t,
+          TLAPACK_SMATRIX A_t>
+int rot_sequence3(side_t side,
+                  direction_t direction,
+                  const C_t& C,
+                  const S_t& S,
+                  A_t& A,
+                  const RotSequence3Opts& opts = {})
+{
+    using T = type_t<A_t>;
+    using TC = type_t<C_t>;
+    using TS = type_t<S_t>;
+    using idx_t = size_type<A_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = (side == Side::Left) ? m - 1 : n - 1;
+    const idx_t l = ncols(C);
+
+    // Check arguments
+    tlapack_check(side == Side::Left || side == Side::Right);
+    tlapack_check(direction == Direction::Forward ||
+                  direction == Direction::Backward);
+    tlapack_check((idx_t)nrows(C) == k);
+    tlapack_check((idx_t)nrows(S) == k);
+    tlapack_check((idx_t)ncols(S) == l);
+
+    // quick return
+    if (k < 1 || l < 1) return 0;
+
+    const bool leftSide = (side == Side::Left);
+    const bool forward = (direction == Direction::Forward);
+
+    // Number of vectors updated by each rotation and number of steps
+    const idx_t nv = leftSide ? n : m;
+    const idx_t nsteps = k + 2 * (l - 1);
+
+    // Applies rotation q of sequence j to the vectors jv0 to jv1-1
+    auto apply = [&](idx_t q, idx_t j, idx_t jv0, idx_t jv1) {
+        const idx_t i = forward ? k - 1 - q : q;
+        const TC c = C(i, j);
+        const TS s = S(i, j);
+        if (c == TC(1) && s == TS(0)) return;
+        if (leftSide) {
+            for (idx_t jv = jv0; jv < jv1; ++jv) {
+                const T temp = c * A(i, jv) + s * A(i + 1, jv);
+                A(i + 1, jv) = -conj(s) * A(i, jv) + c * A(i + 1, jv);
+                A(i, jv) = temp;
+            }
+        }
+        else {
+            for (idx_t jv = jv0; jv < jv1; ++jv) {
+                const T temp = c * A(jv, i) + conj(s) * A(jv, i + 1);
+                A(jv, i + 1) = -s * A(jv, i) + c * A(jv, i + 1);
+                A(jv, i) = temp;
+            }
+        }
+    };
+
+    // Applies all rotations, in wavefront order, to the vectors jv0 to jv1-1
+    auto applyAll = [&](idx_t jv0, idx_t jv1) {
+        for (idx_t step = 0; step < nsteps; ++step) {
+            // Sequences j with 0 <= step - 2j < k
+            const idx_t j0 = (step >= k) ? (step - k) / 2 + 1 : 0;
+            const idx_t j1 = min(l, step / 2 + 1);
+            for (idx_t j = j0; j < j1; ++j)
+                apply(step - 2 * j, j, jv0, jv1);
+        }
+    };
+
+    // If the rotations act on rows of a column-major matrix, or on columns of
+    // a row-major one, the entries of each vector are adjacent in memory and
+    // all rotations are applied to one vector at a time. Otherwise, the
+    // entries of A that a rotation updates are contiguous, and A is updated
+    // in slabs of nb vectors
+    constexpr bool colMajor = (layout<A_t> == Layout::ColMajor);
+    const bool contiguousPairs = (leftSide == colMajor);
+    const idx_t nb = contiguousPairs ? 1 : max<idx_t>(1, opts.nb);
+    const idx_t nslabs = (nv + nb - 1) / nb;
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(static) if (nslabs > 1 && k * l >= 64)
+#endif
+    for (idx_t b = 0; b < nslabs; ++b)
+        applyAll(b * nb, min(nv, (b + 1) * nb));
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_ROT_SEQUENCE3_HH
@@ -0,0 +1,302 @@
+/// @file schur_reorder.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dtrsen.f
+/// and from the blocked reordering described in
+/// D. Kressner, Block algorithms for reordering standard and generalized Schur
+/// forms, ACM Trans. Math. Softw. 32(4), 2006.
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_SCHUR_REORDER_HH
+#define TLAPACK_SCHUR_REORDER_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/schur_move.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for schur_reorder
+ */
+struct SchurReorderOpts {
+    size_t nb = 32;  ///< Maximum number of rows of selected eigenvalue
+                     ///< blocks that are moved together in a window
+    size_t nw = 64;  ///< Size of the window in which the swaps are performed.
+                     ///< Values smaller than 2*nb are replaced by 2*nb.
+};
+
+/** Worspace query of schur_reorder()
+ *
+ * @param[in] want_q bool
+ *      Whether or not to apply the transformations to Q
+ * @param[in] A n-by-n matrix.
+ *      Matrix in Schur form.
+ * @param[in] Q n-by-n matrix.
+ * @param[in] select Vector of length n.
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrix_t, TLAPACK_VECTOR select_t>
+constexpr WorkInfo schur_reorder_worksize(bool want_q,
+                                          const matrix_t& A,
+                                          const matrix_t& Q,
+                                          const select_t& select,
+                                          const SchurReorderOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = ncols(A);
+    const idx_t nb = max<idx_t>(2, opts.nb);
+    const idx_t nw = min(n, max<idx_t>(opts.nw, 2 * nb));
+
+    if (n <= 1) return WorkInfo();
+
+    // The window, its orthogonal factor and a buffer for the off-window
+    // updates
+    return WorkInfo(nw, 3 * nw);
+}
+
+/** @copybrief schur_reorder()
+ * Workspace is provided as an argument.
+ * @copydetails schur_reorder()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR select_t,
+          TLAPACK_WORKSPACE work_t>
+int schur_reorder_work(bool want_q,
+                       matrix_t& A,
+                       matrix_t& Q,
+                       const select_t& select,
+                       size_type<matrix_t>& m,
+                       work_t& work,
+                       const SchurReorderOpts& opts = {})
+{
+    using TA = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<TA>;
+
+    // Constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = ncols(A);
+    const idx_t nb = max<idx_t>(2, opts.nb);
+    const idx_t nw = min(n, max<idx_t>(opts.nw, 2 * nb));
+
+    // check arguments
+    tlapack_check(nrows(A) == n);
+    if (want_q) {
+        tlapack_check(nrows(Q) == n);
+        tlapack_check(ncols(Q) == n);
+    }
+    tlapack_check((idx_t)size(select) >= n);
+
+    // Quick return
+    m = 0;
+    if (n == 0) return 0;
+
+    // Size of the eigenvalue block of S starting at row i
+    auto block_size = [&](const auto& S, idx_t i) -> idx_t {
+        if (is_real<TA>)
+            if (i + 1 < (idx_t)nrows(S))
+                if (S(i + 1, i) != zero) return 2;
+        return 1;
+    };
+
+    // Count the dimension of the invariant subspace
+    for (idx_t i = 0; i < n;) {
+        const idx_t bs = block_size(A, i);
+        if (select[i] || (bs == 2 && select[i + 1])) m += bs;
+        i += bs;
+    }
+    if (n == 1) return 0;
+
+    // Workspace matrices. TW holds a copy of the window, V accumulates the
+    // transformations and W is used in the off-window updates.
+    auto [TV, work1] = reshape(work, nw, 2 * nw);
+    auto [W, work2] = reshape(work1, nw, nw);
+
+    // Rows 0:ks are already in their final position. Rows ks:iuntouched
+    // contain non-selected eigenvalues only. Rows iuntouched:n were not
+    // modified, and the entries of select refer to them.
+    idx_t ks = 0;
+    idx_t iuntouched = 0;
+
+    while (ks < m) {
+        // Find the next cluster of at most nb rows of selected eigenvalues.
+        // iend is the row after the last block of the cluster.
+        idx_t nsel = 0;
+        idx_t iend = iuntouched;
+        for (idx_t i = iuntouched; i < n;) {
+            const idx_t bs = block_size(A, i);
+            if (select[i] || (bs == 2 && select[i + 1])) {
+                if (nsel + bs > nb) break;
+                nsel += bs;
+                iend = i + bs;
+            }
+            i += bs;
+        }
+        if (nsel == 0) break;
+
+        // Chase the cluster upwards, one window at a time. The rows
+        // wend-ncarried:wend of the window contain blocks of the cluster that
+        // were moved in the previous window.
+        idx_t wend = iend;
+        idx_t ncarried = 0;
+        while (true) {
+            idx_t wstart = (wend - ks > nw) ? wend - nw : ks;
+            if (is_real<TA>)
+                if (wstart > ks)
+                    if (A(wstart, wstart - 1) != zero) ++wstart;
+            const idx_t nwin = wend - wstart;
+
+            auto A_window = slice(A, range{wstart, wend}, range{wstart, wend});
+            auto TW = slice(TV, range{0, nwin}, range{0, nwin});
+            auto V = slice(TV, range{0, nwin}, range{nw, nw + nwin});
+            lacpy(GENERAL, A_window, TW);
+            laset(GENERAL, zero, one, V);
+
+            // Move the selected blocks of the window to its top
+            int ierr = 0;
+            idx_t ilst = 0;
+            for (idx_t i = 0; i < nwin;) {
+                const idx_t bs = block_size(TW, i);
+                const idx_t iglobal = wstart + i;
+                const bool selected =
+                    (iglobal >= wend - ncarried) ||
+                    (iglobal >= iuntouched &&
+                     (select[iglobal] || (bs == 2 && select[iglobal + 1])));
+                if (selected) {
+                    if (i != ilst) {
+                        idx_t ifst = i;
+                        idx_t ilst2 = ilst;
+                        ierr = schur_move(true, TW, V, ifst, ilst2);
+                        if (ierr) break;
+                    }
+                    ilst += bs;
+                }
+                i += bs;
+            }
+
+            // Copy the window back and update the rest of A and Q
+            lacpy(GENERAL, TW, A_window);
+            if (wend < n) {
+                for (idx_t j = wend; j < n; j += nw) {
+                    const idx_t jb = min(nw, n - j);
+                    auto A_slice =
+                        slice(A, range{wstart, wend}, range{j, j + jb});
+                    auto W_slice = slice(W, range{0, nwin}, range{0, jb});
+                    gemm(CONJ_TRANS, NO_TRANS, one, V, A_slice, W_slice);
+                    lacpy(GENERAL, W_slice, A_slice);
+                }
+            }
+            if (wstart > 0) {
+                for (idx_t i = 0; i < wstart; i += nw) {
+                    const idx_t ib = min(nw, wstart - i);
+                    auto A_slice =
+                        slice(A, range{i, i + ib}, range{wstart, wend});
+                    auto W_slice = slice(W, range{0, ib}, range{0, nwin});
+                    gemm(NO_TRANS, NO_TRANS, one, A_slice, V, W_slice);
+                    lacpy(GENERAL, W_slice, A_slice);
+                }
+            }
+            if (want_q) {
+                for (idx_t i = 0; i < n; i += nw) {
+                    const idx_t ib = min(nw, n - i);
+                    auto Q_slice =
+                        slice(Q, range{i, i + ib}, range{wstart, wend});
+                    auto W_slice = slice(W, range{0, ib}, range{0, nwin});
+                    gemm(NO_TRANS, NO_TRANS, one, Q_slice, V, W_slice);
+                    lacpy(GENERAL, W_slice, Q_slice);
+                }
+            }
+
+            // The swap failed, return with error
+            if (ierr) return 1;
+
+            if (wstart == ks) break;
+            wend = wstart + ilst;
+            ncarried = ilst;
+        }
+
+        ks += nsel;
+        iuntouched = iend;
+    }
+
+    return 0;
+}
+
+/** schur_reorder reorders the Schur factorization of a matrix
+ *  S = Q*A*Q**H, so that a selected cluster of eigenvalues appears in
+ *  the leading diagonal blocks of S.
+ *
+ *  The leading m columns of Q form an orthonormal basis for the invariant
+ *  subspace corresponding to the selected eigenvalues.
+ *
+ *  This is a blocked algorithm. Groups of at most opts.nb rows of selected
+ *  eigenvalues are moved upwards inside windows of size opts.nw. The
+ *  swaps inside each window only touch a copy of the window, and the
+ *  accumulated orthogonal transformation is applied to the rest of A and to Q
+ *  using matrix-matrix multiplications.
+ *
+ * @return  0 if success
+ * @return  1 two adjacent blocks were too close to swap (the problem
+ *            is very ill-conditioned); A may have been partially
+ *            reordered, and A and Q are still consistent.
+ *
+ * @param[in]     want_q bool
+ *                Whether or not to apply the transformations to Q
+ * @param[in,out] A n-by-n matrix.
+ *                Must be in Schur form
+ * @param[in,out] Q n-by-n matrix.
+ *                Orthogonal matrix, not referenced if want_q is false
+ * @param[in]     select Boolean vector of length n.
+ *                select[i] is true if the eigenvalue in A(i,i) is selected.
+ *                If A(i:i+2,i:i+2) is a 2x2 diagonal block, both eigenvalues
+ *                are selected if either select[i] or select[i+1] is true.
+ * @param[out]    m integer
+ *                Dimension of the invariant subspace associated with the
+ *                selected eigenvalues.
+ * @param[in]     opts Options.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_VECTOR select_t>
+int schur_reorder(bool want_q,
+                  matrix_t& A,
+                  matrix_t& Q,
+                  const select_t& select,
+                  size_type<matrix_t>& m,
+                  const SchurReorderOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = schur_reorder_worksize<T>(want_q, A, Q, select, opts);
+    std::vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return schur_reorder_work(want_q, A, Q, select, m, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_SCHUR_REORDER_HH
@@ -0,0 +1,187 @@
+/// @file stebz.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dstebz.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STEBZ_HH
+#define TLAPACK_STEBZ_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// Selects which eigenvalues are computed
+enum class EigenRange : char {
+    All = 'A',    ///< All eigenvalues
+    Value = 'V',  ///< Eigenvalues in the half-open interval (vl, vu]
+    Index = 'I'   ///< Eigenvalues il to iu-1, in ascending order
+};
+
+/** Computes selected eigenvalues of a real symmetric tridiagonal matrix T by
+ * bisection.
+ *
+ * The number of eigenvalues of T smaller than a given x is obtained from
+ * the Sturm sequence of T - x*I. Each selected eigenvalue is then computed
+ * independently by bisection on its index, in parallel when <T>LAPACK is
+ * built with TLAPACK_USE_OPENMP. The eigenvalues are computed to an
+ * absolute accuracy of about 2*eps*||T||.
+ *
+ * @return  0 if success.
+ * @return  i > 0 if i eigenvalues did not converge.
+ *
+ * @param[in] range
+ *      - EigenRange::All: all eigenvalues are computed.
+ *      - EigenRange::Value: the eigenvalues in (vl, vu] are computed.
+ *      - EigenRange::Index: the eigenvalues il to iu-1 are computed.
+ *
+ * @param[in] vl real.
+ * @param[in] vu real.
+ *      If range = EigenRange::Value, the interval (vl, vu]. vl < vu.
+ *      Not referenced otherwise.
+ *
+ * @param[in] il integer.
+ * @param[in] iu integer.
+ *      If range = EigenRange::Index, the indices of the smallest and one past
+ *      the largest eigenvalue to be computed. 0 <= il <= iu <= n.
+ *      Not referenced otherwise.
+ *
+ * @param[in] d Real vector of length n.
+ *      The diagonal elements of the tridiagonal matrix T.
+ *
+ * @param[in] e Real vector of length n-1.
+ *      The off-diagonal elements of the tridiagonal matrix T.
+ *
+ * @param[out] w Real vector of length at least m.
+ *      The selected eigenvalues in ascending order.
+ *
+ * @param[out] m integer.
+ *      The number of eigenvalues found.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SVECTOR d_t,
+          TLAPACK_SVECTOR e_t,
+          TLAPACK_SVECTOR w_t,
+          TLAPACK_REAL real_t>
+int stebz(EigenRange range,
+          const real_t& vl,
+          const real_t& vu,
+          size_type<d_t> il,
+          size_type<d_t> iu,
+          const d_t& d,
+          const e_t& e,
+          w_t& w,
+          size_type<d_t>& m)
+{
+    using idx_t = size_type<d_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t two(2);
+    const real_t eps = ulp<real_t>();
+    const real_t safmin = safe_min<real_t>();
+    const idx_t n = size(d);
+
+    // check arguments
+    tlapack_check(range == EigenRange::All || range == EigenRange::Value ||
+                  range == EigenRange::Index);
+    tlapack_check((idx_t)size(e) >= n - 1 || n == 0);
+    tlapack_check(range != EigenRange::Value || vl < vu);
+    tlapack_check(range != EigenRange::Index || (il <= iu && iu <= n));
+
+    // quick return
+    m = 0;
+    if (n == 0) return 0;
+
+    // Minimum pivot allowed in the Sturm sequence
+    real_t pivmin = one;
+    for (idx_t i = 0; i + 1 < n; ++i)
+        pivmin = max(pivmin, e[i] * e[i]);
+    pivmin *= safmin;
+
+    // Gershgorin interval [gl, gu] containing all eigenvalues
+    real_t gl = d[0];
+    real_t gu = d[0];
+    for (idx_t i = 0; i < n; ++i) {
+        real_t r = zero;
+        if (i > 0) r += abs(e[i - 1]);
+        if (i + 1 < n) r += abs(e[i]);
+        gl = min(gl, d[i] - r);
+        gu = max(gu, d[i] + r);
+    }
+    const real_t tnorm = max(abs(gl), abs(gu));
+    gl -= two * eps * tnorm * real_t(n) + two * pivmin;
+    gu += two * eps * tnorm * real_t(n) + two * pivmin;
+
+    // Returns the number of eigenvalues of T smaller than x
+    auto count = [&](const real_t& x) {
+        idx_t c = 0;
+        real_t q = d[0] - x;
+        if (abs(q) < pivmin) q = -pivmin;
+        if (q < zero) ++c;
+        for (idx_t i = 1; i < n; ++i) {
+            q = (d[i] - x) - (e[i - 1] / q) * e[i - 1];
+            if (abs(q) < pivmin) q = -pivmin;
+            if (q < zero) ++c;
+        }
+        return c;
+    };
+
+    // Indices of the eigenvalues to be computed
+    idx_t ilo = 0, ihi = n;
+    if (range == EigenRange::Index) {
+        ilo = il;
+        ihi = iu;
+    }
+    else if (range == EigenRange::Value) {
+        ilo = (vl <= gl) ? 0 : (vl >= gu) ? n : count(vl);
+        ihi = (vu <= gl) ? 0 : (vu >= gu) ? n : count(vu);
+    }
+    m = ihi - ilo;
+    tlapack_check((idx_t)size(w) >= m);
+
+    // Absolute tolerance and maximum number of bisection steps. Each step
+    // halves the interval, which is at most about n/eps times larger than
+    // the tolerance
+    const real_t atol = two * eps * tnorm + two * pivmin;
+    const idx_t itmax = idx_t(digits<real_t>()) + 64;
+
+    int info = 0;
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (idx_t k = ilo; k < ihi; ++k) {
+        real_t lo = gl;
+        real_t hi = gu;
+        idx_t it = 0;
+        for (; it < itmax; ++it) {
+            if (hi - lo <= max(atol, two * eps * max(abs(lo), abs(hi))))
+                break;
+            const real_t mid = (lo + hi) / two;
+            if (count(mid) > k)
+                hi = mid;
+            else
+                lo = mid;
+        }
+        if (it == itmax) {
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp atomic
+#endif
+            ++info;
+        }
+        w[k - ilo] = (lo + hi) / two;
+    }
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STEBZ_HH
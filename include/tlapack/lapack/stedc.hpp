@@ -0,0 +1,250 @@
+/// @file stedc.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dstedc.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STEDC_HH
+#define TLAPACK_STEDC_HH
+
+#include <algorithm>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laed1.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/steqr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for stedc
+ */
+struct StedcOpts {
+    size_t smlsiz = 25;  ///< Maximum size of the subproblems solved by steqr
+};
+
+/** Computes all eigenvalues and eigenvectors of a real symmetric tridiagonal
+ * matrix T using the divide and conquer method.
+ *
+ * The matrix is first split at negligible off-diagonal elements. Each
+ * unreduced block is then recursively divided in halves by rank-one tearing
+ * until the subproblems have size at most max(2, opts.smlsiz). Those are
+ * solved by steqr(), and the solutions are merged back with laed1(), which
+ * deflates the problem and solves the secular equation.
+ *
+ * Independent subproblems and merges of the same level of the recursion tree
+ * are processed in parallel when <T>LAPACK is built with TLAPACK_USE_OPENMP.
+ *
+ * @return  0 if success.
+ * @return  nonzero if steqr() or laed1() failed on a subproblem.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, the diagonal elements of the tridiagonal matrix T.
+ *      On exit, if success, the eigenvalues of T in ascending order.
+ *
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, the off-diagonal elements of the tridiagonal matrix T.
+ *      On exit, e has been destroyed.
+ *
+ * @param[in,out] Z nz-by-n matrix.
+ *      On entry, an nz-by-n matrix with orthonormal columns.
+ *      On exit, Z is overwritten by Z * Qt, where Qt is the orthogonal
+ *      matrix of eigenvectors of T.
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR d_t,
+          TLAPACK_SVECTOR e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int stedc(d_t& d, e_t& e, matrix_t& Z, const StedcOpts& opts = {})
+{
+    using idx_t = size_type<d_t>;
+    using real_t = type_t<d_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t eps = uroundoff<real_t>();
+    const idx_t n = size(d);
+    const idx_t nz = nrows(Z);
+    const idx_t smlsiz = max<idx_t>(2, opts.smlsiz);
+
+    // check arguments
+    tlapack_check((idx_t)size(e) >= n - 1 || n == 0);
+    tlapack_check(ncols(Z) == n);
+
+    // quick return
+    if (n <= 1) return 0;
+
+    // Small problems are solved directly
+    if (n <= smlsiz) return steqr(true, d, e, Z);
+
+    // Qt accumulates the eigenvectors of T, which are real
+    std::vector<real_t> Qt_;
+    auto Qt = new_matrix(Qt_, n, n);
+    laset(GENERAL, zero, one, Qt);
+
+    // Workspace of the merges. The merge of the subproblems that start at
+    // the row o uses the rows 3*n*o to 3*n*o + laed1_worksize of work, so
+    // that the merges of the same level of the tree can run in parallel.
+    std::vector<real_t> work_;
+    auto work = new_matrix(work_, 3 * n * n, 1);
+
+    int info = 0;
+    idx_t start = 0;
+    while (start < n) {
+        // Find the end of the unreduced block that starts at start
+        idx_t end = start;
+        for (; end < n - 1; ++end) {
+            const real_t tiny =
+                eps * sqrt(abs(d[end])) * sqrt(abs(d[end + 1]));
+            if (abs(e[end]) <= tiny) break;
+        }
+        const idx_t m = end + 1 - start;
+        const idx_t off = start;
+        start = end + 1;
+        if (m == 1) continue;
+
+        // Scale the block
+        real_t orgnrm = zero;
+        for (idx_t i = off; i < off + m; ++i)
+            orgnrm = max(orgnrm, abs(d[i]));
+        for (idx_t i = off; i + 1 < off + m; ++i)
+            orgnrm = max(orgnrm, abs(e[i]));
+        if (orgnrm == zero) continue;
+        for (idx_t i = off; i < off + m; ++i)
+            d[i] /= orgnrm;
+        for (idx_t i = off; i + 1 < off + m; ++i)
+            e[i] /= orgnrm;
+
+        // Divide the block in halves until all subproblems are small enough.
+        // The first half of each subproblem has the smaller size.
+        std::vector<idx_t> sizes(1, m);
+        while (*std::max_element(sizes.begin(), sizes.end()) > smlsiz) {
+            std::vector<idx_t> halves(2 * sizes.size());
+            for (size_t j = 0; j < sizes.size(); ++j) {
+                halves[2 * j] = sizes[j] / 2;
+                halves[2 * j + 1] = sizes[j] - sizes[j] / 2;
+            }
+            sizes.swap(halves);
+        }
+        const idx_t nsub = sizes.size();
+        std::vector<idx_t> offsets(nsub);
+        offsets[0] = off;
+        for (idx_t j = 1; j < nsub; ++j)
+            offsets[j] = offsets[j - 1] + sizes[j - 1];
+
+        // Rank-one tearing at each cut
+        for (idx_t j = 1; j < nsub; ++j) {
+            const idx_t c = offsets[j];
+            const real_t beta = abs(e[c - 1]);
+            d[c - 1] -= beta;
+            d[c] -= beta;
+        }
+
+        // Solve the subproblems
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (idx_t j = 0; j < nsub; ++j) {
+            const idx_t o = offsets[j];
+            const idx_t s = sizes[j];
+            auto dj = slice(d, range{o, o + s});
+            auto ej = slice(e, range{o, o + s - 1});
+            auto Qj = slice(Qt, range{o, o + s}, range{o, o + s});
+            if (steqr(true, dj, ej, Qj) != 0) {
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp critical
+#endif
+                info = (info == 0) ? int(o + s) : info;
+            }
+        }
+        if (info != 0) return info;
+
+        // Merge the subproblems, one level of the tree at a time
+        while (sizes.size() > 1) {
+            const idx_t npairs = sizes.size() / 2;
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (idx_t j = 0; j < npairs; ++j) {
+                const idx_t o = offsets[2 * j];
+                const idx_t s1 = sizes[2 * j];
+                const idx_t s = s1 + sizes[2 * j + 1];
+                auto dj = slice(d, range{o, o + s});
+                auto Qj = slice(Qt, range{o, o + s}, range{o, o + s});
+                const WorkInfo workinfo =
+                    laed1_worksize<real_t>(dj, Qj, s1, e[o + s1 - 1]);
+                auto workj = slice(
+                    work, range{3 * n * o, 3 * n * o + (idx_t)workinfo.size()},
+                    range{0, 1});
+                if (laed1_work(dj, Qj, s1, e[o + s1 - 1], workj) != 0) {
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp critical
+#endif
+                    info = (info == 0) ? int(o + s) : info;
+                }
+            }
+            if (info != 0) return info;
+
+            for (idx_t j = 0; j < npairs; ++j) {
+                sizes[j] = sizes[2 * j] + sizes[2 * j + 1];
+                offsets[j] = offsets[2 * j];
+            }
+            sizes.resize(npairs);
+            offsets.resize(npairs);
+        }
+
+        // Scale back
+        for (idx_t i = off; i < off + m; ++i)
+            d[i] *= orgnrm;
+    }
+
+    // Order eigenvalues and eigenvectors
+    for (idx_t i = 0; i < n - 1; ++i) {
+        // Selection sort to minimize swaps of eigenvectors
+        idx_t k = i;
+        real_t p = d[i];
+        for (idx_t j = i + 1; j < n; ++j) {
+            if (d[j] < p) {
+                k = j;
+                p = d[j];
+            }
+        }
+        if (k != i) {
+            d[k] = d[i];
+            d[i] = p;
+            auto q1 = slice(Qt, range{0, n}, i);
+            auto q2 = slice(Qt, range{0, n}, k);
+            tlapack::swap(q1, q2);
+        }
+    }
+
+    // Z := Z * Qt
+    std::vector<type_t<matrix_t>> W_;
+    auto W = new_matrix(W_, nz, n);
+    gemm(NO_TRANS, NO_TRANS, one, Z, Qt, W);
+    lacpy(GENERAL, W, Z);
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STEDC_HH
@@ -0,0 +1,235 @@
+/// @file stein.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dstein.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STEIN_HH
+#define TLAPACK_STEIN_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/larnv.hpp"
+
+namespace tlapack {
+
+/** Computes the eigenvectors of a real symmetric tridiagonal matrix T
+ * corresponding to specified eigenvalues, using inverse iteration.
+ *
+ * Each eigenvector is computed from at most 5 steps of inverse iteration
+ * with a random starting vector. T - w[j]*I is factored once by Gaussian
+ * elimination with partial pivoting, and tiny pivots are perturbed. Vectors
+ * associated with eigenvalues that are closer than 1e-3*||T||_1 form a
+ * cluster, and are reorthogonalized against each other by modified
+ * Gram-Schmidt; close eigenvalues are perturbed so that the factorizations
+ * differ. Different clusters are processed in parallel when <T>LAPACK is
+ * built with TLAPACK_USE_OPENMP.
+ *
+ * @return  0 if success.
+ * @return  i > 0 if i eigenvectors failed to converge in the maximum number
+ *          of iterations. Their current iterates are stored in Z.
+ *
+ * @param[in] d Real vector of length n.
+ *      The diagonal elements of the tridiagonal matrix T.
+ *
+ * @param[in] e Real vector of length n-1.
+ *      The off-diagonal elements of the tridiagonal matrix T.
+ *
+ * @param[in] w Real vector of length m.
+ *      The eigenvalues for which eigenvectors are computed, in ascending
+ *      order, as returned by stebz().
+ *
+ * @param[out] Z n-by-m matrix.
+ *      The computed eigenvectors, with real entries. The eigenvector
+ *      associated with w[j] is stored in the j-th column of Z. Each
+ *      eigenvector has unit 2-norm and its largest component is positive.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SVECTOR d_t,
+          TLAPACK_SVECTOR e_t,
+          TLAPACK_SVECTOR w_t,
+          TLAPACK_SMATRIX matrix_t>
+int stein(const d_t& d, const e_t& e, const w_t& w, matrix_t& Z)
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<type_t<d_t>>;
+
+    // Functors
+    Create<vector_type<d_t>> new_vector;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t ten(10);
+    const real_t odm3(1.0e-3);
+    const real_t eps = ulp<real_t>();
+    const idx_t n = nrows(Z);
+    const idx_t m = ncols(Z);
+    const idx_t maxits = 5;
+    const idx_t extra = 2;
+
+    // check arguments
+    tlapack_check((idx_t)size(d) == n);
+    tlapack_check((idx_t)size(e) >= n - 1 || n == 0);
+    tlapack_check((idx_t)size(w) >= m);
+
+    // quick return
+    if (n == 0 || m == 0) return 0;
+    if (n == 1) {
+        for (idx_t j = 0; j < m; ++j)
+            Z(0, j) = T(one);
+        return 0;
+    }
+
+    // 1-norm of T and thresholds
+    real_t onenrm = zero;
+    for (idx_t i = 0; i < n; ++i) {
+        real_t r = abs(d[i]);
+        if (i > 0) r += abs(e[i - 1]);
+        if (i + 1 < n) r += abs(e[i]);
+        onenrm = max(onenrm, r);
+    }
+    if (onenrm == zero) onenrm = one;
+    const real_t ortol = odm3 * onenrm;
+    const real_t pivtol = eps * onenrm;
+    const real_t dtpcrt = sqrt(real_t(0.1) / real_t(n));
+
+    // Clusters of close eigenvalues
+    std::vector<idx_t> clusters(1, 0);
+    for (idx_t j = 1; j < m; ++j)
+        if (w[j] - w[j - 1] > ortol) clusters.push_back(j);
+    clusters.push_back(m);
+    const idx_t ncl = clusters.size() - 1;
+
+    int info = 0;
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (idx_t cl = 0; cl < ncl; ++cl) {
+        // Factorization of T - xj*I and the current iterate
+        std::vector<real_t> u1(n), u2(n - 1), u3(n - 1), lm(n - 1);
+        std::vector<bool> piv(n - 1);
+        std::vector<real_t> x_;
+        auto x = new_vector(x_, n);
+
+        real_t xjm = zero;
+        for (idx_t j = clusters[cl]; j < clusters[cl + 1]; ++j) {
+            // Perturb the eigenvalue if it is too close to the previous one
+            real_t xj = w[j];
+            if (j > clusters[cl]) {
+                const real_t pertol = ten * eps * max(abs(xj), onenrm);
+                if (xj - xjm < pertol) xj = xjm + pertol;
+            }
+            xjm = xj;
+
+            // LU factorization with partial pivoting of T - xj*I. Row k of U
+            // has the entries u1[k], u2[k] and u3[k] in the columns k, k+1
+            // and k+2
+            real_t a = d[0] - xj;
+            real_t b = e[0];
+            for (idx_t k = 0; k + 1 < n; ++k) {
+                const real_t c = e[k];
+                const real_t dk1 = d[k + 1] - xj;
+                const real_t ek1 = (k + 2 < n) ? e[k + 1] : zero;
+                if (abs(a) >= abs(c)) {
+                    piv[k] = false;
+                    lm[k] = (a == zero) ? zero : c / a;
+                    u1[k] = a;
+                    u2[k] = b;
+                    u3[k] = zero;
+                    a = dk1 - lm[k] * b;
+                    b = ek1;
+                }
+                else {
+                    piv[k] = true;
+                    lm[k] = a / c;
+                    u1[k] = c;
+                    u2[k] = dk1;
+                    u3[k] = ek1;
+                    a = b - lm[k] * dk1;
+                    b = -lm[k] * ek1;
+                }
+            }
+            u1[n - 1] = a;
+            for (idx_t k = 0; k < n; ++k)
+                if (abs(u1[k]) < pivtol)
+                    u1[k] = (u1[k] < zero) ? -pivtol : pivtol;
+
+            // Random starting vector
+            unsigned iseed = unsigned(j) + 1;
+            larnv<2>(iseed, x);
+
+            idx_t nrmchk = 0;
+            idx_t its = 0;
+            for (; its < maxits; ++its) {
+                // Scale the iterate so that the solution does not overflow
+                real_t asum = zero;
+                for (idx_t i = 0; i < n; ++i)
+                    asum += abs(x[i]);
+                const real_t scl =
+                    real_t(n) * onenrm * max(eps, abs(u1[n - 1])) / asum;
+                for (idx_t i = 0; i < n; ++i)
+                    x[i] *= scl;
+
+                // Solve (T - xj*I) x = x
+                for (idx_t k = 0; k + 1 < n; ++k) {
+                    if (piv[k]) std::swap(x[k], x[k + 1]);
+                    x[k + 1] -= lm[k] * x[k];
+                }
+                for (idx_t k = n; k-- > 0;) {
+                    real_t s = x[k];
+                    if (k + 1 < n) s -= u2[k] * x[k + 1];
+                    if (k + 2 < n) s -= u3[k] * x[k + 2];
+                    x[k] = s / u1[k];
+                }
+
+                // Reorthogonalize against the previous vectors of the
+                // cluster
+                for (idx_t p = clusters[cl]; p < j; ++p) {
+                    real_t ztr = zero;
+                    for (idx_t i = 0; i < n; ++i)
+                        ztr += x[i] * real(Z(i, p));
+                    for (idx_t i = 0; i < n; ++i)
+                        x[i] -= ztr * real(Z(i, p));
+                }
+
+                // Check the growth of the iterate
+                real_t nrm = zero;
+                for (idx_t i = 0; i < n; ++i)
+                    nrm = max(nrm, abs(x[i]));
+                if (nrm < dtpcrt) continue;
+                if (++nrmchk >= extra + 1) break;
+            }
+            if (its == maxits) {
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp atomic
+#endif
+                ++info;
+            }
+
+            // Normalize so that the largest component is positive
+            real_t nrm2 = zero;
+            idx_t jmax = 0;
+            for (idx_t i = 0; i < n; ++i) {
+                nrm2 += x[i] * x[i];
+                if (abs(x[i]) > abs(x[jmax])) jmax = i;
+            }
+            real_t scl = one / sqrt(nrm2);
+            if (x[jmax] < zero) scl = -scl;
+            for (idx_t i = 0; i < n; ++i)
+                Z(i, j) = T(scl * x[i]);
+        }
+    }
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STEIN_HH
@@ -0,0 +1,335 @@
+/// @file steqr.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dsteqr.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STEQR_HH
+#define TLAPACK_STEQR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/lartg.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/laev2.hpp"
+#include "tlapack/lapack/lapy2.hpp"
+
+namespace tlapack {
+
+/** Computes all eigenvalues and, optionally, eigenvectors of a real symmetric
+ * tridiagonal matrix T using the implicit QL or QR method.
+ *
+ * The eigenvectors of T are accumulated on the matrix Z. If Z contains, on
+ * entry, the unitary matrix Q used to reduce a Hermitian matrix A to
+ * tridiagonal form, as returned by hetrd() and unmtr(), then on exit Z
+ * contains the eigenvectors of A.
+ *
+ * @return  0 if success.
+ * @return  i+1 if the algorithm failed to find all of the eigenvalues in a
+ *          total of 30n iterations. In this case, i off-diagonal elements
+ *          have not converged to zero; on exit, d and e contain the elements
+ *          of a symmetric tridiagonal matrix which is unitarily similar to
+ *          the original matrix.
+ *
+ * @param[in] want_z bool
+ *      If true, the eigenvectors are accumulated on Z.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, the diagonal elements of the tridiagonal matrix T.
+ *      On exit, if success, the eigenvalues of T in ascending order.
+ *
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, the off-diagonal elements of the tridiagonal matrix T.
+ *      On exit, e has been destroyed.
+ *
+ * @param[in,out] Z nz-by-n matrix.
+ *      On entry, an nz-by-n matrix with orthonormal columns.
+ *      On exit, if want_z, Z is overwritten by Z * Qt, where Qt is the
+ *      orthogonal matrix of eigenvectors of T.
+ *      Not referenced if want_z is false.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR d_t,
+          TLAPACK_SVECTOR e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
+{
+    using idx_t = size_type<d_t>;
+    using real_t = type_t<d_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t two(2);
+    const real_t three(3);
+    const idx_t n = size(d);
+    const idx_t nmaxit = 30 * n;
+    const real_t eps = uroundoff<real_t>();
+    const real_t eps2 = eps * eps;
+    const real_t safmin = safe_min<real_t>();
+    const real_t safmax = one / safmin;
+    const real_t ssfmax = sqrt(safmax) / three;
+    const real_t ssfmin = sqrt(safmin) / eps2;
+
+    // check arguments
+    tlapack_check((idx_t)size(e) >= n - 1 || n == 0);
+    tlapack_check(!want_z || ncols(Z) == n);
+
+    // quick return
+    if (n <= 1) return 0;
+
+    // Returns the column j of Z
+    auto zcol = [&Z](idx_t j) {
+        return slice(Z, pair<idx_t, idx_t>{0, nrows(Z)}, j);
+    };
+
+    // Applies a scaling factor to the block l:lend+1 of the tridiagonal
+    auto scale_block = [](d_t& d, e_t& e, idx_t l, idx_t lend, real_t s) {
+        for (idx_t i = l; i <= lend; ++i)
+            d[i] *= s;
+        for (idx_t i = l; i < lend; ++i)
+            e[i] *= s;
+    };
+
+    idx_t jtot = 0;
+    idx_t l1 = 0;
+    while (l1 < n) {
+        if (l1 > 0) e[l1 - 1] = zero;
+
+        // Look for a small off-diagonal element to split the matrix
+        idx_t m = l1;
+        for (; m < n - 1; ++m) {
+            const real_t tst = abs(e[m]);
+            if (tst == zero) break;
+            if (tst <= (sqrt(abs(d[m])) * sqrt(abs(d[m + 1]))) * eps) {
+                e[m] = zero;
+                break;
+            }
+        }
+
+        idx_t l = l1;
+        const idx_t lsv = l;
+        idx_t lend = m;
+        const idx_t lendsv = lend;
+        l1 = m + 1;
+        if (lend == l) continue;
+
+        // Scale submatrix in rows and columns l to lend
+        real_t anorm = zero;
+        for (idx_t i = l; i <= lend; ++i)
+            anorm = max(anorm, abs(d[i]));
+        for (idx_t i = l; i < lend; ++i)
+            anorm = max(anorm, abs(e[i]));
+        if (anorm == zero) continue;
+
+        int iscale = 0;
+        if (anorm > ssfmax) {
+            iscale = 1;
+            scale_block(d, e, l, lend, ssfmax / anorm);
+        }
+        else if (anorm < ssfmin) {
+            iscale = 2;
+            scale_block(d, e, l, lend, ssfmin / anorm);
+        }
+
+        // Choose between QL and QR iteration
+        if (abs(d[lend]) < abs(d[l])) {
+            lend = lsv;
+            l = lendsv;
+        }
+
+        if (lend > l) {
+            // QL Iteration
+            while (l <= lend && jtot < nmaxit) {
+                // Look for small subdiagonal element
+                for (m = l; m < lend; ++m) {
+                    const real_t tst = square(abs(e[m]));
+                    if (tst <= (eps2 * abs(d[m])) * abs(d[m + 1]) + safmin)
+                        break;
+                }
+                if (m < lend) e[m] = zero;
+
+                real_t p = d[l];
+                if (m == l) {
+                    // Eigenvalue found
+                    d[l] = p;
+                    l = l + 1;
+                    continue;
+                }
+
+                // If remaining matrix is 2-by-2, compute its eigensystem
+                // directly
+                if (m == l + 1) {
+                    real_t rt1, rt2, c, s;
+                    laev2(d[l], e[l], d[l + 1], rt1, rt2, c, s);
+                    if (want_z) {
+                        auto z1 = zcol(l);
+                        auto z2 = zcol(l + 1);
+                        rot(z1, z2, c, s);
+                    }
+                    d[l] = rt1;
+                    d[l + 1] = rt2;
+                    e[l] = zero;
+                    l = l + 2;
+                    continue;
+                }
+
+                jtot = jtot + 1;
+
+                // Form shift
+                real_t g = (d[l + 1] - p) / (two * e[l]);
+                real_t r = lapy2(g, one);
+                g = d[m] - p + (e[l] / (g + ((g >= zero) ? r : -r)));
+
+                real_t s = one;
+                real_t c = one;
+                p = zero;
+
+                // Inner loop
+                for (idx_t i = m; i-- > l;) {
+                    const real_t f = s * e[i];
+                    const real_t b = c * e[i];
+                    lartg(g, f, c, s, r);
+                    if (i != m - 1) e[i + 1] = r;
+                    g = d[i + 1] - p;
+                    r = (d[i] - g) * s + two * c * b;
+                    p = s * r;
+                    d[i + 1] = g + p;
+                    g = c * r - b;
+
+                    // Accumulate the transformation
+                    if (want_z) {
+                        auto z1 = zcol(i);
+                        auto z2 = zcol(i + 1);
+                        rot(z1, z2, c, -s);
+                    }
+                }
+
+                d[l] = d[l] - p;
+                e[l] = g;
+            }
+        }
+        else {
+            // QR Iteration
+            while (l >= lend && jtot < nmaxit) {
+                // Look for small superdiagonal element
+                for (m = l; m > lend; --m) {
+                    const real_t tst = square(abs(e[m - 1]));
+                    if (tst <= (eps2 * abs(d[m])) * abs(d[m - 1]) + safmin)
+                        break;
+                }
+                if (m > lend) e[m - 1] = zero;
+
+                real_t p = d[l];
+                if (m == l) {
+                    // Eigenvalue found
+                    d[l] = p;
+                    if (l == lend) break;
+                    l = l - 1;
+                    continue;
+                }
+
+                // If remaining matrix is 2-by-2, compute its eigensystem
+                // directly
+                if (m + 1 == l) {
+                    real_t rt1, rt2, c, s;
+                    laev2(d[l - 1], e[l - 1], d[l], rt1, rt2, c, s);
+                    if (want_z) {
+                        auto z1 = zcol(l - 1);
+                        auto z2 = zcol(l);
+                        rot(z1, z2, c, s);
+                    }
+                    d[l - 1] = rt1;
+                    d[l] = rt2;
+                    e[l - 1] = zero;
+                    if (l < lend + 2) break;
+                    l = l - 2;
+                    continue;
+                }
+
+                jtot = jtot + 1;
+
+                // Form shift
+                real_t g = (d[l - 1] - p) / (two * e[l - 1]);
+                real_t r = lapy2(g, one);
+                g = d[m] - p + (e[l - 1] / (g + ((g >= zero) ? r : -r)));
+
+                real_t s = one;
+                real_t c = one;
+                p = zero;
+
+                // Inner loop
+                for (idx_t i = m; i < l; ++i) {
+                    const real_t f = s * e[i];
+                    const real_t b = c * e[i];
+                    lartg(g, f, c, s, r);
+                    if (i != m) e[i - 1] = r;
+                    g = d[i] - p;
+                    r = (d[i + 1] - g) * s + two * c * b;
+                    p = s * r;
+                    d[i] = g + p;
+                    g = c * r - b;
+
+                    // Accumulate the transformation
+                    if (want_z) {
+                        auto z1 = zcol(i);
+                        auto z2 = zcol(i + 1);
+                        rot(z1, z2, c, s);
+                    }
+                }
+
+                d[l] = d[l] - p;
+                e[l - 1] = g;
+            }
+        }
+
+        // Undo scaling if necessary
+        if (iscale == 1) scale_block(d, e, lsv, lendsv, anorm / ssfmax);
+        if (iscale == 2) scale_block(d, e, lsv, lendsv, anorm / ssfmin);
+
+        // Check for no convergence to an eigenvalue after a total of n*maxit
+        // iterations
+        if (jtot >= nmaxit) {
+            int info = 0;
+            for (idx_t i = 0; i < n - 1; ++i)
+                if (e[i] != zero) ++info;
+            return info;
+        }
+    }
+
+    // Order eigenvalues and eigenvectors
+    for (idx_t i = 0; i < n - 1; ++i) {
+        // Selection sort to minimize swaps of eigenvectors
+        idx_t k = i;
+        real_t p = d[i];
+        for (idx_t j = i + 1; j < n; ++j) {
+            if (d[j] < p) {
+                k = j;
+                p = d[j];
+            }
+        }
+        if (k != i) {
+            d[k] = d[i];
+            d[i] = p;
+            if (want_z) {
+                auto z1 = zcol(i);
+                auto z2 = zcol(k);
+                tlapack::swap(z1, z2);
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STEQR_HH
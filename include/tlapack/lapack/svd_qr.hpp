@@ -18,11 +18,25 @@
 #include "tlapack/blas/rot.hpp"
 #include "tlapack/blas/swap.hpp"
 #include "tlapack/lapack/gebrd.hpp"
+#include "tlapack/lapack/rot_sequence3.hpp"
 #include "tlapack/lapack/singularvalues22.hpp"
 #include "tlapack/lapack/svd22.hpp"
 
 namespace tlapack {
 
+/**
+ * Options struct for svd_qr
+ */
+struct SvdQrOpts {
+    /// Number of QR sweeps whose rotations are applied to the singular vectors
+    /// together, @see rot_sequence3(). If 1, the singular vectors are updated
+    /// after each sweep
+    size_t nsweeps = 16;
+
+    /// Options for rot_sequence3()
+    RotSequence3Opts rotOpts = {};
+};
+
 /**
  * Computes the singular values and, optionally, the right and/or
  * left singular vectors from the singular value decomposition (SVD) of
@@ -75,6 +89,12 @@ namespace tlapack {
  *      On entry, an n-by-nvt unitary matrix.
  *      On exit, Vt is overwritten by P^H * Vt.
  *
+ * @param[in] opts Options.
+ *      - @c opts.nsweeps: The rotations of up to opts.nsweeps consecutive
+ *        sweeps in the same direction are stored and applied to U and Vt
+ *        with one call to rot_sequence3(), which updates the singular vectors
+ *        in a single pass.
+ *
  * @ingroup computational
  */
 template <class matrix_t,
@@ -88,13 +108,17 @@ int svd_qr(Uplo uplo,
            d_t& d,
            e_t& e,
            matrix_t& U,
-           matrix_t& Vt)
+           matrix_t& Vt,
+           const SvdQrOpts& opts = {})
 {
     using idx_t = size_type<matrix_t>;
     using range = pair<idx_t, idx_t>;
     using T = type_t<matrix_t>;
     using real_t = real_type<T>;
 
+    // Functors
+    Create<matrix_t> new_rmatrix;
+
     // constants
     const real_t one(1);
     const real_t zero(0);
@@ -108,23 +132,93 @@ int svd_qr(Uplo uplo,
     // Quick return
     if (n == 0) return 0;
 
+    // Cosines and sines of the rotations of a batch of sweeps. Column j
+    // stores sweep j of the batch, and rotation i acts on the singular
+    // vectors i and i+1. Entries that no sweep sets are identity rotations,
+    // which rot_sequence3() skips
+    const idx_t nsweeps = max<idx_t>(1, opts.nsweeps);
+    std::vector<real_t> Cu_, Su_, Cvt_, Svt_;
+    auto Cu = new_rmatrix(Cu_, want_u ? n - 1 : 0, nsweeps);
+    auto Su = new_rmatrix(Su_, want_u ? n - 1 : 0, nsweeps);
+    auto Cvt = new_rmatrix(Cvt_, want_vt ? n - 1 : 0, nsweeps);
+    auto Svt = new_rmatrix(Svt_, want_vt ? n - 1 : 0, nsweeps);
+
+    // State of the batch: number of sweeps, direction of the sequences and
+    // range of rotations ilo:ihi that are touched
+    idx_t nbatch = 0;
+    Direction batchDir = Direction::Backward;
+    idx_t ilo = n;
+    idx_t ihi = 0;
+
+    // Applies the stored rotations to the singular vectors
+    auto flush = [&]() {
+        if (nbatch > 0 && ilo < ihi) {
+            const range rrot{ilo, ihi};
+            const range rseq{0, nbatch};
+            if (want_u) {
+                auto Ui = slice(U, range{0, nrows(U)}, range{ilo, ihi + 1});
+                rot_sequence3(Side::Right, batchDir, slice(Cu, rrot, rseq),
+                              slice(Su, rrot, rseq), Ui, opts.rotOpts);
+            }
+            if (want_vt) {
+                auto Vti = slice(Vt, range{ilo, ihi + 1}, range{0, ncols(Vt)});
+                rot_sequence3(Side::Left, batchDir, slice(Cvt, rrot, rseq),
+                              slice(Svt, rrot, rseq), Vti, opts.rotOpts);
+            }
+        }
+        nbatch = 0;
+        ilo = n;
+        ihi = 0;
+    };
+
+    // Starts a new sweep with sequences in the given direction and returns
+    // the column where its rotations are stored
+    auto new_sweep = [&](Direction direction) -> idx_t {
+        if (nbatch == nsweeps || (nbatch > 0 && direction != batchDir))
+            flush();
+        batchDir = direction;
+        for (idx_t i = 0; i + 1 < n; ++i) {
+            if (want_u) {
+                Cu(i, nbatch) = one;
+                Su(i, nbatch) = zero;
+            }
+            if (want_vt) {
+                Cvt(i, nbatch) = one;
+                Svt(i, nbatch) = zero;
+            }
+        }
+        return nbatch++;
+    };
+
+    // Stores rotation i of sweep js
+    auto store = [&](idx_t js, idx_t i, real_t cu, real_t su, real_t cvt,
+                     real_t svt) {
+        if (want_u) {
+            Cu(i, js) = cu;
+            Su(i, js) = su;
+        }
+        if (want_vt) {
+            Cvt(i, js) = cvt;
+            Svt(i, js) = svt;
+        }
+        ilo = min(ilo, i);
+        ihi = max(ihi, i + 1);
+    };
+
     // If the matrix is lower bidiagonal, apply a sequence of rotations
     // to make it upper bidiagonal.
     if (uplo == Uplo::Lower) {
         real_t c, s, r;
 
+        const idx_t js = new_sweep(Direction::Backward);
         for (idx_t i = 0; i < n - 1; ++i) {
             lartg(d[i], e[i], c, s, r);
             d[i] = r;
             e[i] = s * d[i + 1];
             d[i + 1] = c * d[i + 1];
 
-            // Update singular vectors if desired
-            if (want_u) {
-                auto u1 = col(U, i);
-                auto u2 = col(U, i + 1);
-                rot(u1, u2, c, s);
-            }
+            // Store the rotation for the singular vectors
+            store(js, i, c, s, one, zero);
         }
     }
 
@@ -164,6 +258,7 @@ int svd_qr(Uplo uplo,
     for (idx_t iter = 0; iter <= itmax; ++iter) {
         if (iter == itmax) {
             // The QR algorithm failed to converge, return with error.
+            flush();
             return istop;
         }
 
@@ -200,17 +295,8 @@ int svd_qr(Uplo uplo,
             d[istart + 1] = sigmn;
             e[istart] = zero;
 
-            // Update singular vectors if desired
-            if (want_u) {
-                auto u1 = col(U, istart);
-                auto u2 = col(U, istart + 1);
-                rot(u1, u2, csl, snl);
-            }
-            if (want_vt) {
-                auto vt1 = row(Vt, istart);
-                auto vt2 = row(Vt, istart + 1);
-                rot(vt1, vt2, csr, snr);
-            }
+            // Store the rotations for the singular vectors
+            store(new_sweep(batchDir), istart, csl, snl, csr, snr);
 
             istop = istop - 2;
             istart = 0;
@@ -310,22 +396,14 @@ int svd_qr(Uplo uplo,
                 sn = zero;
                 oldcs = one;
                 oldsn = zero;
+                const idx_t js = new_sweep(Direction::Backward);
                 for (idx_t i = istart; i < istop - 1; ++i) {
                     lartg(d[i] * cs, e[i], cs, sn, r);
                     if (i > istart) e[i - 1] = oldsn * r;
                     lartg(oldcs * r, d[i + 1] * sn, oldcs, oldsn, d[i]);
 
-                    // Update singular vectors if desired
-                    if (want_u) {
-                        auto u1 = col(U, i);
-                        auto u2 = col(U, i + 1);
-                        rot(u1, u2, oldcs, oldsn);
-                    }
-                    if (want_vt) {
-                        auto vt1 = row(Vt, i);
-                        auto vt2 = row(Vt, i + 1);
-                        rot(vt1, vt2, cs, sn);
-                    }
+                    // Store the rotations for the singular vectors
+                    store(js, i, oldcs, oldsn, cs, sn);
                 }
                 real_t h = d[istop - 1] * cs;
                 d[istop - 1] = h * oldcs;
@@ -337,22 +415,14 @@ int svd_qr(Uplo uplo,
                 sn = zero;
                 oldcs = one;
                 oldsn = zero;
+                const idx_t js = new_sweep(Direction::Forward);
                 for (idx_t i = istop - 1; i > istart; --i) {
                     lartg(d[i] * cs, e[i - 1], cs, sn, r);
                     if (i < istop - 1) e[i] = oldsn * r;
                     lartg(oldcs * r, d[i - 1] * sn, oldcs, oldsn, d[i]);
 
-                    // Update singular vectors if desired
-                    if (want_u) {
-                        auto u1 = col(U, i - 1);
-                        auto u2 = col(U, i);
-                        rot(u1, u2, cs, -sn);
-                    }
-                    if (want_vt) {
-                        auto vt1 = row(Vt, i - 1);
-                        auto vt2 = row(Vt, i);
-                        rot(vt1, vt2, oldcs, -oldsn);
-                    }
+                    // Store the rotations for the singular vectors
+                    store(js, i - 1, cs, -sn, oldcs, -oldsn);
                 }
                 real_t h = d[istart] * cs;
                 d[istart] = h * oldcs;
@@ -366,6 +436,7 @@ int svd_qr(Uplo uplo,
                 real_t f = (abs(d[istart]) - shift) *
                            (real_t(sgn(d[istart])) + shift / d[istart]);
                 real_t g = e[istart];
+                const idx_t js = new_sweep(Direction::Backward);
                 for (idx_t i = istart; i < istop - 1; ++i) {
                     real_t r, csl, snl, csr, snr;
                     lartg(f, g, csr, snr, r);
@@ -384,17 +455,8 @@ int svd_qr(Uplo uplo,
                         e[i + 1] = csl * e[i + 1];
                     }
 
-                    // Update singular vectors if desired
-                    if (want_u) {
-                        auto u1 = col(U, i);
-                        auto u2 = col(U, i + 1);
-                        rot(u1, u2, csl, snl);
-                    }
-                    if (want_vt) {
-                        auto vt1 = row(Vt, i);
-                        auto vt2 = row(Vt, i + 1);
-                        rot(vt1, vt2, csr, snr);
-                    }
+                    // Store the rotations for the singular vectors
+                    store(js, i, csl, snl, csr, snr);
                 }
                 e[istop - 2] = f;
             }
@@ -402,6 +464,7 @@ int svd_qr(Uplo uplo,
                 real_t f = (abs(d[istop - 1]) - shift) *
                            (real_t(sgn(d[istop - 1])) + shift / d[istop - 1]);
                 real_t g = e[istop - 2];
+                const idx_t js = new_sweep(Direction::Forward);
                 for (idx_t i = istop - 1; i > istart; --i) {
                     real_t r, csl, snl, csr, snr;
                     lartg(f, g, csr, snr, r);
@@ -420,23 +483,17 @@ int svd_qr(Uplo uplo,
                         e[i - 2] = csl * e[i - 2];
                     }
 
-                    // Update singular vectors if desired
-                    if (want_u) {
-                        auto u1 = col(U, i - 1);
-                        auto u2 = col(U, i);
-                        rot(u1, u2, csr, -snr);
-                    }
-                    if (want_vt) {
-                        auto vt1 = row(Vt, i - 1);
-                        auto vt2 = row(Vt, i);
-                        rot(vt1, vt2, csl, -snl);
-                    }
+                    // Store the rotations for the singular vectors
+                    store(js, i - 1, csr, -snr, csl, -snl);
                 }
                 e[istart] = f;
             }
         }
     }
 
+    // Apply the remaining rotations to the singular vectors
+    flush();
+
     // All singular values converged, so make them positive
     for (idx_t i = 0; i < n; ++i) {
         if (d[i] < zero) {
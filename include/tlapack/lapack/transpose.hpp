@@ -1,4 +1,4 @@
-/// @file transpose.hpp Out of place transpose
+/// @file transpose.hpp Out of place and in place transpose
 /// @author Thijs Steel, KU Leuven, Belgium
 //
 // Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
@@ -14,15 +14,225 @@
 
 namespace tlapack {
 struct TransposeOpts {
-    // Optimization parameter. Matrices smaller than nx will not
-    // be transposed using recursion. Must be at least 2.s
+    // Optimization parameter. Blocks with at most nx rows and nx columns
+    // are not split further by the recursion. Must be at least 2.
     size_t nx = 16;
 };
 
+namespace internal {
+
+    /// Returns conj(a) if conjugate is true, and a otherwise
+    template <bool conjugate, class T>
+    constexpr auto transpose_op(const T& a) noexcept
+    {
+        if constexpr (conjugate)
+            return conj(a);
+        else
+            return a;
+    }
+
+    /** Out of place transpose of a small block.
+     *
+     * The block is traversed in 4-by-4 tiles. Each tile is loaded column by
+     * column from A into local variables, which the compiler keeps in
+     * registers, and stored column by column into B.
+     *
+     * @ingroup auxiliary
+     */
+    template <bool conjugate, class matrixA_t, class matrixB_t>
+    void transpose_kernel(const matrixA_t& A, matrixB_t& B)
+    {
+        using idx_t = size_type<matrixA_t>;
+        using TA = type_t<matrixA_t>;
+
+        // constants
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t m4 = m - m % 4;
+        const idx_t n4 = n - n % 4;
+
+        for (idx_t j = 0; j < n4; j += 4) {
+            for (idx_t i = 0; i < m4; i += 4) {
+                TA r[4][4];
+                for (idx_t jj = 0; jj < 4; ++jj)
+                    for (idx_t ii = 0; ii < 4; ++ii)
+                        r[jj][ii] = A(i + ii, j + jj);
+                for (idx_t ii = 0; ii < 4; ++ii)
+                    for (idx_t jj = 0; jj < 4; ++jj)
+                        B(j + jj, i + ii) = transpose_op<conjugate>(r[jj][ii]);
+            }
+            for (idx_t i = m4; i < m; ++i)
+                for (idx_t jj = j; jj < j + 4; ++jj)
+                    B(jj, i) = transpose_op<conjugate>(A(i, jj));
+        }
+        for (idx_t j = n4; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                B(j, i) = transpose_op<conjugate>(A(i, j));
+    }
+
+    /** Cache-oblivious out of place transpose.
+     *
+     * The largest dimension is halved until the blocks have at most nx rows
+     * and columns.
+     *
+     * @ingroup auxiliary
+     */
+    template <bool conjugate, class matrixA_t, class matrixB_t>
+    void transpose_recursive(const matrixA_t& A,
+                             matrixB_t& B,
+                             size_type<matrixA_t> nx)
+    {
+        using idx_t = size_type<matrixA_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+
+        if (m <= nx && n <= nx) {
+            transpose_kernel<conjugate>(A, B);
+        }
+        else if (m >= n) {
+            const idx_t m1 = m / 2;
+            const auto A0 = rows(A, range(0, m1));
+            const auto A1 = rows(A, range(m1, m));
+            auto B0 = cols(B, range(0, m1));
+            auto B1 = cols(B, range(m1, m));
+            transpose_recursive<conjugate>(A0, B0, nx);
+            transpose_recursive<conjugate>(A1, B1, nx);
+        }
+        else {
+            const idx_t n1 = n / 2;
+            const auto A0 = cols(A, range(0, n1));
+            const auto A1 = cols(A, range(n1, n));
+            auto B0 = rows(B, range(0, n1));
+            auto B1 = rows(B, range(n1, n));
+            transpose_recursive<conjugate>(A0, B0, nx);
+            transpose_recursive<conjugate>(A1, B1, nx);
+        }
+    }
+
+    /** Swaps X with the transpose of Y, where X is m-by-n and Y is n-by-m.
+     *
+     * On exit, X = op(Y_in)^T and Y = op(X_in)^T, where op is either the
+     * identity or the conjugation. Cache-oblivious.
+     *
+     * @ingroup auxiliary
+     */
+    template <bool conjugate, class matrixX_t, class matrixY_t>
+    void transpose_swap(matrixX_t& X, matrixY_t& Y, size_type<matrixX_t> nx)
+    {
+        using idx_t = size_type<matrixX_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t m = nrows(X);
+        const idx_t n = ncols(X);
+
+        if (m <= nx && n <= nx) {
+            for (idx_t j = 0; j < n; ++j) {
+                for (idx_t i = 0; i < m; ++i) {
+                    const auto x = X(i, j);
+                    X(i, j) = transpose_op<conjugate>(Y(j, i));
+                    Y(j, i) = transpose_op<conjugate>(x);
+                }
+            }
+        }
+        else if (m >= n) {
+            const idx_t m1 = m / 2;
+            auto X0 = rows(X, range(0, m1));
+            auto X1 = rows(X, range(m1, m));
+            auto Y0 = cols(Y, range(0, m1));
+            auto Y1 = cols(Y, range(m1, m));
+            transpose_swap<conjugate>(X0, Y0, nx);
+            transpose_swap<conjugate>(X1, Y1, nx);
+        }
+        else {
+            const idx_t n1 = n / 2;
+            auto X0 = cols(X, range(0, n1));
+            auto X1 = cols(X, range(n1, n));
+            auto Y0 = rows(Y, range(0, n1));
+            auto Y1 = rows(Y, range(n1, n));
+            transpose_swap<conjugate>(X0, Y0, nx);
+            transpose_swap<conjugate>(X1, Y1, nx);
+        }
+    }
+
+    /** Cache-oblivious in place transpose of a square matrix.
+     *
+     * @ingroup auxiliary
+     */
+    template <bool conjugate, class matrix_t>
+    void transpose_square(matrix_t& A, size_type<matrix_t> nx)
+    {
+        using idx_t = size_type<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t n = nrows(A);
+
+        if (n <= nx) {
+            for (idx_t j = 0; j < n; ++j) {
+                if constexpr (conjugate) A(j, j) = conj(A(j, j));
+                for (idx_t i = j + 1; i < n; ++i) {
+                    const auto x = A(i, j);
+                    A(i, j) = transpose_op<conjugate>(A(j, i));
+                    A(j, i) = transpose_op<conjugate>(x);
+                }
+            }
+        }
+        else {
+            const idx_t n1 = n / 2;
+            auto A00 = slice(A, range(0, n1), range(0, n1));
+            auto A10 = slice(A, range(n1, n), range(0, n1));
+            auto A01 = slice(A, range(0, n1), range(n1, n));
+            auto A11 = slice(A, range(n1, n), range(n1, n));
+            transpose_square<conjugate>(A00, nx);
+            transpose_square<conjugate>(A11, nx);
+            transpose_swap<conjugate>(A10, A01, nx);
+        }
+    }
+
+    /** In place transpose of a matrix stored contiguously in a vector, by
+     * following the cycles of the permutation.
+     *
+     * @ingroup auxiliary
+     */
+    template <bool conjugate, class idx_t, class vector_t>
+    void transpose_cycles(idx_t m, idx_t n, vector_t& x)
+    {
+        const idx_t mn = m * n;
+
+        // Entry (i,j) of the m-by-n matrix is moved from position i + j*m to
+        // position j + i*n. The first and last entries never move.
+        std::vector<bool> visited(mn, false);
+        for (idx_t s = 1; s + 1 < mn; ++s) {
+            if (visited[s]) continue;
+
+            auto t = x[s];
+            idx_t p = s;
+            do {
+                const idx_t q = (p / m) + (p % m) * n;
+                const auto aux = x[q];
+                x[q] = transpose_op<conjugate>(t);
+                t = aux;
+                visited[q] = true;
+                p = q;
+            } while (p != s);
+        }
+        if constexpr (conjugate) {
+            if (mn > 0) x[0] = conj(x[0]);
+            if (mn > 1) x[mn - 1] = conj(x[mn - 1]);
+        }
+    }
+
+}  // namespace internal
+
 /**
  *
  * @brief conjugate transpose a matrix A into a matrix B.
  *
+ * Cache-oblivious algorithm. The largest dimension is halved recursively
+ * until the blocks have at most opts.nx rows and columns, which are then
+ * transposed in 4-by-4 tiles held in registers.
+ *
  * @param[in] A m-by-n matrix
  *      The matrix to be transposed
  *
@@ -37,47 +247,22 @@ template <TLAPACK_SMATRIX matrixA_t, TLAPACK_SMATRIX matrixB_t>
 void conjtranspose(matrixA_t& A, matrixB_t& B, const TransposeOpts& opts = {})
 {
     using idx_t = size_type<matrixA_t>;
-    using range = pair<idx_t, idx_t>;
-
-    const idx_t m = nrows(A);
-    const idx_t n = ncols(A);
 
-    tlapack_check(m == ncols(B));
-    tlapack_check(n == nrows(B));
+    tlapack_check(nrows(A) == ncols(B));
+    tlapack_check(ncols(A) == nrows(B));
     tlapack_check(opts.nx >= 2);
 
-    if (min(m, n) <= (idx_t)opts.nx) {
-        // The matrix is small, use direct method and end recursion
-        for (idx_t i = 0; i < m; ++i)
-            for (idx_t j = 0; j < n; ++j)
-                B(j, i) = conj(A(i, j));
-    }
-    else {
-        // The matrix is large, split into subblocks and use recursion
-        const idx_t m1 = m / 2;
-        const idx_t n1 = n / 2;
-
-        auto A00 = slice(A, range(0, m1), range(0, n1));
-        auto A01 = slice(A, range(0, m1), range(n1, n));
-        auto A10 = slice(A, range(m1, m), range(0, n1));
-        auto A11 = slice(A, range(m1, m), range(n1, n));
-
-        auto B00 = slice(B, range(0, n1), range(0, m1));
-        auto B01 = slice(B, range(0, n1), range(m1, m));
-        auto B10 = slice(B, range(n1, n), range(0, m1));
-        auto B11 = slice(B, range(n1, n), range(m1, m));
-
-        conjtranspose(A00, B00, opts);
-        conjtranspose(A01, B10, opts);
-        conjtranspose(A10, B01, opts);
-        conjtranspose(A11, B11, opts);
-    }
+    internal::transpose_recursive<true>(A, B, (idx_t)opts.nx);
 }
 
 /**
  *
  * @brief transpose a matrix A into a matrix B.
  *
+ * Cache-oblivious algorithm. The largest dimension is halved recursively
+ * until the blocks have at most opts.nx rows and columns, which are then
+ * transposed in 4-by-4 tiles held in registers.
+ *
  * @param[in] A m-by-n matrix
  *      The matrix to be transposed
  *
@@ -92,41 +277,109 @@ template <TLAPACK_SMATRIX matrixA_t, TLAPACK_SMATRIX matrixB_t>
 void transpose(matrixA_t& A, matrixB_t& B, const TransposeOpts& opts = {})
 {
     using idx_t = size_type<matrixA_t>;
-    using range = pair<idx_t, idx_t>;
 
-    const idx_t m = nrows(A);
-    const idx_t n = ncols(A);
+    tlapack_check(nrows(A) == ncols(B));
+    tlapack_check(ncols(A) == nrows(B));
+    tlapack_check(opts.nx >= 2);
+
+    internal::transpose_recursive<false>(A, B, (idx_t)opts.nx);
+}
+
+/**
+ *
+ * @brief conjugate transpose a square matrix A in place.
+ *
+ * @param[in,out] A n-by-n matrix
+ *      On exit, A is replaced by A**H
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX matrix_t>
+void conjtranspose_inplace(matrix_t& A, const TransposeOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check(opts.nx >= 2);
+
+    internal::transpose_square<true>(A, (idx_t)opts.nx);
+}
 
-    tlapack_check(m == ncols(B));
-    tlapack_check(n == nrows(B));
+/**
+ *
+ * @brief transpose a square matrix A in place.
+ *
+ * @param[in,out] A n-by-n matrix
+ *      On exit, A is replaced by A**T
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX matrix_t>
+void transpose_inplace(matrix_t& A, const TransposeOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    tlapack_check(nrows(A) == ncols(A));
     tlapack_check(opts.nx >= 2);
 
-    if (min(m, n) <= (idx_t)opts.nx) {
-        // The matrix is small, use direct method and end recursion
-        for (idx_t i = 0; i < m; ++i)
-            for (idx_t j = 0; j < n; ++j)
-                B(j, i) = A(i, j);
-    }
-    else {
-        // The matrix is large, split into subblocks and use recursion
-        const idx_t m1 = m / 2;
-        const idx_t n1 = n / 2;
-
-        auto A00 = slice(A, range(0, m1), range(0, n1));
-        auto A01 = slice(A, range(0, m1), range(n1, n));
-        auto A10 = slice(A, range(m1, m), range(0, n1));
-        auto A11 = slice(A, range(m1, m), range(n1, n));
-
-        auto B00 = slice(B, range(0, n1), range(0, m1));
-        auto B01 = slice(B, range(0, n1), range(m1, m));
-        auto B10 = slice(B, range(n1, n), range(0, m1));
-        auto B11 = slice(B, range(n1, n), range(m1, m));
-
-        transpose(A00, B00, opts);
-        transpose(A01, B10, opts);
-        transpose(A10, B01, opts);
-        transpose(A11, B11, opts);
-    }
+    internal::transpose_square<false>(A, (idx_t)opts.nx);
+}
+
+/**
+ *
+ * @brief conjugate transpose in place a matrix stored contiguously.
+ *
+ * @see transpose_inplace(idx_t, idx_t, vector_t&)
+ *
+ * @param[in] m Number of rows of the matrix.
+ * @param[in] n Number of columns of the matrix.
+ *
+ * @param[in,out] x Vector of length m*n.
+ *      On entry, the m-by-n matrix A stored column by column.
+ *      On exit, the n-by-m matrix A**H stored column by column.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SVECTOR vector_t>
+void conjtranspose_inplace(size_type<vector_t> m,
+                           size_type<vector_t> n,
+                           vector_t& x)
+{
+    tlapack_check((size_type<vector_t>)size(x) == m * n);
+
+    internal::transpose_cycles<true>(m, n, x);
+}
+
+/**
+ *
+ * @brief transpose in place a matrix stored contiguously.
+ *
+ * The entries are moved along the cycles of the transposition permutation,
+ * so that only one bit of additional memory per entry is needed. The same
+ * routine transposes a row-major n-by-m matrix into a row-major m-by-n
+ * matrix.
+ *
+ * @param[in] m Number of rows of the matrix.
+ * @param[in] n Number of columns of the matrix.
+ *
+ * @param[in,out] x Vector of length m*n.
+ *      On entry, the m-by-n matrix A stored column by column.
+ *      On exit, the n-by-m matrix A**T stored column by column.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SVECTOR vector_t>
+void transpose_inplace(size_type<vector_t> m,
+                       size_type<vector_t> n,
+                       vector_t& x)
+{
+    tlapack_check((size_type<vector_t>)size(x) == m * n);
+
+    internal::transpose_cycles<false>(m, n, x);
 }
 
 }  // namespace tlapack
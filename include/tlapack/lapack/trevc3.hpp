@@ -0,0 +1,456 @@
+/// @file trevc3.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dtrevc3.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TREVC3_HH
+#define TLAPACK_TREVC3_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/ladiv.hpp"
+#include "tlapack/lapack/lange.hpp"
+#include "tlapack/lapack/laset.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for trevc3
+ */
+struct Trevc3Opts {
+    size_t nb = 32;  ///< Number of eigenvectors computed together. It is also
+                     ///< the number of rows in each step of the blocked back
+                     ///< substitution.
+};
+
+/** Worspace query of trevc3()
+ *
+ * @param[in] backtransform bool
+ * @param[in] matrixT n-by-n matrix.
+ * @param[in] V n-by-n matrix.
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrixT_t, TLAPACK_SMATRIX matrixV_t>
+constexpr WorkInfo trevc3_worksize(bool backtransform,
+                                   const matrixT_t& matrixT,
+                                   const matrixV_t& V,
+                                   const Trevc3Opts& opts = {})
+{
+    using idx_t = size_type<matrixT_t>;
+
+    const idx_t n = ncols(matrixT);
+    const idx_t nb = min(n, max<idx_t>(2, opts.nb));
+
+    if (n == 0) return WorkInfo();
+
+    // Block of eigenvectors of T, and the back-transformed block
+    return WorkInfo(n, (backtransform) ? 2 * nb : nb);
+}
+
+/** @copybrief trevc3()
+ * Workspace is provided as an argument.
+ * @copydetails trevc3()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixT_t,
+          TLAPACK_SMATRIX matrixV_t,
+          TLAPACK_WORKSPACE work_t>
+int trevc3_work(bool backtransform,
+                const matrixT_t& T,
+                matrixV_t& V,
+                work_t& work,
+                const Trevc3Opts& opts = {})
+{
+    using TT = type_t<matrixT_t>;
+    using idx_t = size_type<matrixT_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<TT>;
+    using complex_t = complex_type<real_t>;
+
+    // Constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = ncols(T);
+    const idx_t nb = min(n, max<idx_t>(2, opts.nb));
+    const real_t eps = ulp<real_t>();
+    const real_t smlnum = safe_min<real_t>() * ((real_t)n / eps);
+    const real_t bignum = one / smlnum;
+
+    // check arguments
+    tlapack_check(nrows(T) == n);
+    tlapack_check(nrows(V) == n);
+    tlapack_check(ncols(V) == n);
+
+    // Quick return
+    if (n == 0) return 0;
+
+    // Workspace matrices
+    auto [X, work1] = reshape(work, n, nb);
+    auto [W, work2] = (backtransform) ? reshape(work1, n, nb)
+                                      : reshape(work1, 0, 0);
+
+    // Solves (T(0:k,0:k) - lambda I) x = - T(0:k,k:kend) x(k:kend) in the
+    // rows i0:i1 for the eigenvector stored in X(:,c) (and X(:,c+1) if it is
+    // a complex eigenvector of a real matrix). The entries x(i1:kend) must be
+    // known, and their contributions to the rows i0:i1 must not have been
+    // applied yet. Overflow is avoided by scaling the whole eigenvector.
+    auto solve_tile = [&](const auto& lambda, idx_t c, idx_t k, idx_t kend,
+                          idx_t i0, idx_t i1) {
+        using S = std::decay_t<decltype(lambda)>;
+        constexpr bool is_pair = is_real<TT> && is_complex<S>;
+
+        const real_t smin = max(eps * abs1(lambda), smlnum);
+
+        auto getx = [&](idx_t i) -> S {
+            if constexpr (is_pair)
+                return S(X(i, c), X(i, c + 1));
+            else
+                return S(X(i, c));
+        };
+        auto setx = [&](idx_t i, const S& x) {
+            if constexpr (is_pair) {
+                X(i, c) = real(x);
+                X(i, c + 1) = imag(x);
+            }
+            else
+                X(i, c) = x;
+        };
+        auto div = [](const S& x, const S& y) -> S {
+            if constexpr (is_complex<S>)
+                return ladiv(x, y);
+            else
+                return x / y;
+        };
+        auto scale_vector = [&](const real_t& alpha) {
+            for (idx_t i = 0; i < kend; ++i)
+                X(i, c) *= alpha;
+            if constexpr (is_pair)
+                for (idx_t i = 0; i < kend; ++i)
+                    X(i, c + 1) *= alpha;
+        };
+
+        idx_t r = min(i1, kend);
+        while (r > i0) {
+            // Size of the diagonal block T(r0:r,r0:r)
+            idx_t bs = 1;
+            if (is_real<TT>)
+                if (r > i0 + 1)
+                    if (T(r - 1, r - 2) != zero) bs = 2;
+            const idx_t r0 = r - bs;
+
+            if (r0 < k) {
+                if (bs == 1) {
+                    S d = S(T(r0, r0)) - lambda;
+                    if (abs1(d) < smin) d = S(smin);
+                    S b = getx(r0);
+                    if (abs1(d) < one && abs1(b) > bignum * abs1(d)) {
+                        const real_t alpha = one / abs1(b);
+                        scale_vector(alpha);
+                        b *= alpha;
+                    }
+                    setx(r0, div(b, d));
+                }
+                else {
+                    // Solve the 2x2 system with complete pivoting
+                    S M[2][2] = {
+                        {S(T(r0, r0)) - lambda, S(T(r0, r0 + 1))},
+                        {S(T(r0 + 1, r0)), S(T(r0 + 1, r0 + 1)) - lambda}};
+                    S b[2] = {getx(r0), getx(r0 + 1)};
+
+                    idx_t ip = 0, jp = 0;
+                    for (idx_t i = 0; i < 2; ++i)
+                        for (idx_t j = 0; j < 2; ++j)
+                            if (abs1(M[i][j]) > abs1(M[ip][jp])) {
+                                ip = i;
+                                jp = j;
+                            }
+                    if (abs1(M[ip][jp]) < smin) {
+                        M[0][0] = M[1][1] = S(smin);
+                        M[0][1] = M[1][0] = S(zero);
+                        ip = jp = 0;
+                    }
+                    if (ip == 1) {
+                        std::swap(M[0][0], M[1][0]);
+                        std::swap(M[0][1], M[1][1]);
+                        std::swap(b[0], b[1]);
+                    }
+                    if (jp == 1) {
+                        std::swap(M[0][0], M[0][1]);
+                        std::swap(M[1][0], M[1][1]);
+                    }
+
+                    const S l = div(M[1][0], M[0][0]);
+                    S u11 = M[1][1] - l * M[0][1];
+                    if (abs1(u11) < smin) u11 = S(smin);
+                    b[1] -= l * b[0];
+
+                    const real_t bnorm = max(abs1(b[0]), abs1(b[1]));
+                    if (abs1(u11) < one && bnorm > bignum * abs1(u11)) {
+                        const real_t alpha = one / bnorm;
+                        scale_vector(alpha);
+                        b[0] *= alpha;
+                        b[1] *= alpha;
+                    }
+
+                    S x[2];
+                    x[1] = div(b[1], u11);
+                    x[0] = div(b[0] - M[0][1] * x[1], M[0][0]);
+                    if (jp == 1) std::swap(x[0], x[1]);
+
+                    setx(r0, x[0]);
+                    setx(r0 + 1, x[1]);
+                }
+            }
+
+            // Update the rows i0:r0 of the tile
+            for (idx_t j = r0; j < r; ++j) {
+                const S xj = getx(j);
+                for (idx_t i = i0; i < r0; ++i)
+                    setx(i, getx(i) - S(T(i, j)) * xj);
+            }
+
+            r = r0;
+        }
+    };
+
+    // Loop over blocks of eigenvectors, from the last to the first
+    idx_t khi = n;
+    while (khi > 0) {
+        // Eigenvalues klo:khi form the current block. Complex conjugate pairs
+        // are never split.
+        idx_t klo = khi;
+        while (klo > 0) {
+            idx_t bs = 1;
+            if (is_real<TT>)
+                if (klo > 1)
+                    if (T(klo - 1, klo - 2) != zero) bs = 2;
+            if (khi - klo + bs > nb) break;
+            klo -= bs;
+        }
+        const idx_t ncols_blk = khi - klo;
+        auto Xb = slice(X, range{0, n}, range{0, ncols_blk});
+        laset(GENERAL, zero, zero, Xb);
+
+        // Set the last entries of each eigenvector
+        for (idx_t k = klo; k < khi;) {
+            const idx_t c = k - klo;
+            idx_t bs = 1;
+            if (is_real<TT>)
+                if (k + 1 < khi)
+                    if (T(k + 1, k) != zero) bs = 2;
+
+            if (bs == 1) {
+                X(k, c) = TT(one);
+            }
+            else {
+                // Complex right eigenvector of the 2x2 block in standard form
+                const real_t wi =
+                    sqrt(abs(T(k, k + 1))) * sqrt(abs(T(k + 1, k)));
+                if (abs(T(k, k + 1)) >= abs(T(k + 1, k))) {
+                    X(k, c) = one;
+                    X(k + 1, c + 1) = wi / T(k, k + 1);
+                }
+                else {
+                    X(k, c) = -wi / T(k + 1, k);
+                    X(k + 1, c + 1) = one;
+                }
+            }
+            k += bs;
+        }
+
+        // Blocked back substitution
+        idx_t i1 = khi;
+        while (i1 > 0) {
+            idx_t i0 = (i1 > nb) ? i1 - nb : 0;
+            if (is_real<TT>)
+                if (i0 > 0)
+                    if (T(i0, i0 - 1) != zero) --i0;
+
+            // Solve the diagonal block for each eigenvector
+            for (idx_t k = klo; k < khi;) {
+                const idx_t c = k - klo;
+                idx_t bs = 1;
+                if (is_real<TT>)
+                    if (k + 1 < khi)
+                        if (T(k + 1, k) != zero) bs = 2;
+
+                if (bs == 1) {
+                    const TT lambda = T(k, k);
+                    solve_tile(lambda, c, k, k + 1, i0, i1);
+                }
+                else {
+                    const real_t wi =
+                        sqrt(abs(T(k, k + 1))) * sqrt(abs(T(k + 1, k)));
+                    const complex_t lambda(real(T(k, k)), wi);
+                    solve_tile(lambda, c, k, k + 2, i0, i1);
+                }
+                k += bs;
+            }
+
+            if (i0 == 0) break;
+
+            // Protect against overflow in the update
+            auto T12 = slice(T, range{0, i0}, range{i0, i1});
+            const real_t tnorm = lange(INF_NORM, T12);
+            for (idx_t k = klo; k < khi;) {
+                const idx_t c = k - klo;
+                idx_t bs = 1;
+                if (is_real<TT>)
+                    if (k + 1 < khi)
+                        if (T(k + 1, k) != zero) bs = 2;
+
+                real_t xmax(0), ymax(0);
+                for (idx_t i = i0; i < i1; ++i) {
+                    real_t xi = abs1(X(i, c));
+                    if (bs == 2) xi += abs1(X(i, c + 1));
+                    if (xi > xmax) xmax = xi;
+                }
+                for (idx_t i = 0; i < i0; ++i) {
+                    real_t yi = abs1(X(i, c));
+                    if (bs == 2) yi += abs1(X(i, c + 1));
+                    if (yi > ymax) ymax = yi;
+                }
+                if (xmax > one && tnorm > (bignum - ymax) / xmax) {
+                    const real_t alpha = one / xmax;
+                    for (idx_t j = c; j < c + bs; ++j)
+                        for (idx_t i = 0; i < n; ++i)
+                            X(i, j) *= alpha;
+                }
+                k += bs;
+            }
+
+            // Update the remaining rows of all eigenvectors of the block
+            auto X1 = slice(X, range{0, i0}, range{0, ncols_blk});
+            auto X2 = slice(X, range{i0, i1}, range{0, ncols_blk});
+            gemm(NO_TRANS, NO_TRANS, -one, T12, X2, one, X1);
+
+            i1 = i0;
+        }
+
+        // Store the eigenvectors in V
+        auto Vb = slice(V, range{0, n}, range{klo, khi});
+        if (backtransform) {
+            auto Q1 = slice(V, range{0, n}, range{0, khi});
+            auto X1 = slice(X, range{0, khi}, range{0, ncols_blk});
+            auto Wb = slice(W, range{0, n}, range{0, ncols_blk});
+            gemm(NO_TRANS, NO_TRANS, one, Q1, X1, Wb);
+            lacpy(GENERAL, Wb, Vb);
+        }
+        else {
+            lacpy(GENERAL, Xb, Vb);
+        }
+
+        // Normalize the eigenvectors so that the element of largest
+        // magnitude has magnitude 1
+        for (idx_t k = klo; k < khi;) {
+            const idx_t j = k - klo;
+            idx_t bs = 1;
+            if (is_real<TT>)
+                if (k + 1 < khi)
+                    if (T(k + 1, k) != zero) bs = 2;
+
+            real_t emax(0);
+            for (idx_t i = 0; i < n; ++i) {
+                real_t vi = abs1(Vb(i, j));
+                if (bs == 2) vi += abs1(Vb(i, j + 1));
+                if (vi > emax) emax = vi;
+            }
+            if (emax > zero) {
+                const real_t alpha = one / emax;
+                for (idx_t jj = j; jj < j + bs; ++jj)
+                    for (idx_t i = 0; i < n; ++i)
+                        Vb(i, jj) *= alpha;
+            }
+            k += bs;
+        }
+
+        khi = klo;
+    }
+
+    return 0;
+}
+
+/** trevc3 computes the right eigenvectors of an upper quasi-triangular
+ *  matrix T in Schur canonical form.
+ *
+ *  The right eigenvector x of T corresponding to an eigenvalue w is
+ *  defined by T x = w x.
+ *
+ *  If backtransform is true, V must contain an orthogonal matrix Q on entry,
+ *  e.g. the Schur vectors returned by multishift_qr, and the routine computes
+ *  the matrix Q X, where X contains the eigenvectors of T. If T is the Schur
+ *  factor of A = Q T Q**H, then Q X contains the right eigenvectors of A.
+ *
+ *  This is a blocked algorithm. Groups of at most opts.nb eigenvectors are
+ *  computed together. The back substitution is done in blocks of opts.nb
+ *  rows. The diagonal blocks are solved for each eigenvector independently,
+ *  and the remaining rows of all eigenvectors are updated with a
+ *  matrix-matrix multiplication. The back-transformation is also done with a
+ *  matrix-matrix multiplication.
+ *
+ *  The eigenvectors are scaled to avoid overflow, and normalized so that the
+ *  element of largest magnitude has magnitude 1; here the magnitude of a
+ *  complex number (x,y) is taken to be |x| + |y|.
+ *
+ * @return  0 if success
+ *
+ * @param[in] backtransform bool
+ *      - true:  compute Q X, where Q is given on entry in V.
+ *      - false: compute the eigenvectors X of T.
+ *
+ * @param[in] T n-by-n matrix.
+ *      Upper quasi-triangular matrix in Schur canonical form.
+ *      In the real case, 2-by-2 diagonal blocks must be in standard form,
+ *      i.e., with equal diagonal elements and off-diagonal elements of
+ *      opposite signs.
+ *
+ * @param[in,out] V n-by-n matrix.
+ *      On entry, if backtransform is true, V must contain an n-by-n matrix Q.
+ *      On exit, the column j of V contains the right eigenvector associated
+ *      with T(j,j), or with the 2-by-2 diagonal block that contains T(j,j).
+ *      In the real case, if T(j:j+2,j:j+2) is a 2-by-2 diagonal block, the
+ *      eigenvector associated with the eigenvalue with positive imaginary
+ *      part is V(:,j) + i*V(:,j+1). The eigenvector of the complex conjugate
+ *      eigenvalue is the complex conjugate of that vector.
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrixT_t, TLAPACK_SMATRIX matrixV_t>
+int trevc3(bool backtransform,
+           const matrixT_t& T,
+           matrixV_t& V,
+           const Trevc3Opts& opts = {})
+{
+    using work_t = matrix_type<matrixT_t, matrixV_t>;
+    using TT = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = trevc3_worksize<TT>(backtransform, T, V, opts);
+    std::vector<TT> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return trevc3_work(backtransform, T, V, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TREVC3_HH
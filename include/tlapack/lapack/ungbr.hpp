@@ -21,7 +21,7 @@ namespace tlapack {
  * Options struct for ungbr
  */
 struct UngbrOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = 64;  ///< Block size
 };
 
 /** Worspace query of ungbr_q()
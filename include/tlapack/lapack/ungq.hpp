@@ -24,7 +24,10 @@ namespace tlapack {
  * Options struct for ungq
  */
 struct UngqOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = 64;   ///< Block size
+    size_t nc = 256;  ///< Maximum number of columns (or rows) in each panel
+                      ///< of the block reflector updates. @see LarfbOpts
+    LarftVariant larft_variant = LarftVariant::Recursive;  ///< larft variant
 };
 
 /** Worspace query of ungq()
@@ -164,6 +167,10 @@ int ungq_work(direction_t direction,
     // quick return
     if (m <= 0 || n <= 0) return 0;
 
+    // Options for the block reflectors
+    const LarftOpts larftOpts{opts.larft_variant};
+    const LarfbOpts larfbOpts{opts.nc};
+
     // Matrix matrixT
     auto [matrixT, work1] =
         (min(m, n) > nb) ? reshape(work, nb, nb) : reshape(work, 0, 0);
@@ -187,9 +194,10 @@ int ungq_work(direction_t direction,
                     auto matrixTj = slice(matrixT, range{0, ib}, range{0, ib});
                     auto C = slice(A, range{j, m}, range{j + ib, n});
 
-                    larft(FORWARD, COLUMNWISE_STORAGE, V, tauj, matrixTj);
+                    larft(FORWARD, COLUMNWISE_STORAGE, V, tauj, matrixTj,
+                          larftOpts);
                     larfb_work(LEFT_SIDE, NO_TRANS, FORWARD, COLUMNWISE_STORAGE,
-                               V, matrixTj, C, work1);
+                               V, matrixTj, C, work1, larfbOpts);
                 }
 
                 // Apply block reflector to A( 0:m, j:j+ib )$ from the left
@@ -222,9 +230,11 @@ int ungq_work(direction_t direction,
                     auto matrixTj = slice(matrixT, range{0, ib}, range{0, ib});
                     auto C = slice(A, range{0, sizev}, range{0, jj});
 
-                    larft(BACKWARD, COLUMNWISE_STORAGE, V, tauj, matrixTj);
+                    larft(BACKWARD, COLUMNWISE_STORAGE, V, tauj, matrixTj,
+                          larftOpts);
                     larfb_work(LEFT_SIDE, NO_TRANS, BACKWARD,
-                               COLUMNWISE_STORAGE, V, matrixTj, C, work1);
+                               COLUMNWISE_STORAGE, V, matrixTj, C, work1,
+                               larfbOpts);
                 }
 
                 // Apply block reflector to A( 0:m, jj:jj+ib )$ from the left
@@ -254,9 +264,10 @@ int ungq_work(direction_t direction,
                     auto matrixTi = slice(matrixT, range{0, ib}, range{0, ib});
                     auto C = slice(A, range{i + ib, m}, range{i, n});
 
-                    larft(FORWARD, ROWWISE_STORAGE, V, taui, matrixTi);
+                    larft(FORWARD, ROWWISE_STORAGE, V, taui, matrixTi,
+                          larftOpts);
                     larfb_work(RIGHT_SIDE, CONJ_TRANS, FORWARD, ROWWISE_STORAGE,
-                               V, matrixTi, C, work1);
+                               V, matrixTi, C, work1, larfbOpts);
                 }
 
                 // Apply block reflector to A( i:i+ib, 0:n )$ from the right
@@ -289,9 +300,11 @@ int ungq_work(direction_t direction,
                     auto matrixTi = slice(matrixT, range{0, ib}, range{0, ib});
                     auto C = slice(A, range{0, ii}, range{0, sizev});
 
-                    larft(BACKWARD, ROWWISE_STORAGE, V, taui, matrixTi);
+                    larft(BACKWARD, ROWWISE_STORAGE, V, taui, matrixTi,
+                          larftOpts);
                     larfb_work(RIGHT_SIDE, CONJ_TRANS, BACKWARD,
-                               ROWWISE_STORAGE, V, matrixTi, C, work1);
+                               ROWWISE_STORAGE, V, matrixTi, C, work1,
+                               larfbOpts);
                 }
 
                 // Apply block reflector to A( ii:ii+ib, 0:n )$ from the left
@@ -25,7 +25,7 @@ namespace tlapack {
  * Options struct for ungql
  */
 struct UngqlOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = 64;  ///< Block size
 };
 
 /**
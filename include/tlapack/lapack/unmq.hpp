@@ -23,7 +23,10 @@ namespace tlapack {
  * Options struct for unmq
  */
 struct UnmqOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = 32;   ///< Block size
+    size_t nc = 256;  ///< Maximum number of columns (side = Side::Left) or
+                      ///< rows (side = Side::Right) of C in each panel.
+                      ///< If nc = 0, C is not split.
 };
 
 /** Worspace query of unmq()
@@ -195,7 +198,7 @@ int unmq_work(side_t side,
             auto Ci = (side == Side::Left) ? slice(C, rangev, range{0, n})
                                            : slice(C, range{0, m}, rangev);
             larfb_work(side, trans, direction, COLUMNWISE_STORAGE, Vi, matrixTi,
-                       Ci, work1);
+                       Ci, work1, LarfbOpts{opts.nc});
         }
     }
     else {
@@ -216,7 +219,8 @@ int unmq_work(side_t side,
                                            : slice(C, range{0, m}, rangev);
             larfb_work(side,
                        (trans == Op::NoTrans) ? Op::ConjTrans : Op::NoTrans,
-                       direction, ROWWISE_STORAGE, Vi, matrixTi, Ci, work1);
+                       direction, ROWWISE_STORAGE, Vi, matrixTi, Ci, work1,
+                       LarfbOpts{opts.nc});
         }
     }
 
@@ -312,6 +316,365 @@ int unmq(side_t side,
     return unmq_work(side, trans, direction, storeMode, V, tau, C, work, opts);
 }
 
+/** Forms the triangular factors of all block reflectors used by unmq().
+ *
+ * The k reflectors are split in blocks of nb = ncols(TT) reflectors. The
+ * triangular factor of the block starting at reflector i is stored in
+ * TT(i:i+ib,0:ib), where ib = min(nb, k-i). This is the layout used by
+ * gelqt(). The factors only depend on V and tau, so TT can be reused by
+ * unmq_tt() for any number of matrices C. The blocks are independent and
+ * are formed in parallel when <T>LAPACK is built with TLAPACK_USE_OPENMP.
+ *
+ * @param[in] direction
+ *     Indicates how Q is formed from a product of elementary reflectors.
+ *     - Direction::Forward:  $Q = H_1 H_2 ... H_k$.
+ *     - Direction::Backward: $Q = H_k ... H_2 H_1$.
+ *
+ * @param[in] storeMode
+ *     Indicates how the vectors which define the elementary reflectors are
+ * stored:
+ *     - StoreV::Columnwise.
+ *     - StoreV::Rowwise.
+ *
+ * @param[in] V
+ *     - If storeMode = StoreV::Columnwise: the nQ-by-k matrix V.
+ *     - If storeMode = StoreV::Rowwise:    the k-by-nQ matrix V.
+ *
+ * @param[in] tau Vector of length k.
+ *      Scalar factors of the elementary reflectors.
+ *
+ * @param[out] TT k-by-nb matrix.
+ *      On exit, the triangular factors of the block reflectors.
+ *
+ * @return 0 if success.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_DIRECTION direction_t,
+          TLAPACK_STOREV storage_t,
+          TLAPACK_SMATRIX matrixV_t,
+          TLAPACK_SVECTOR vector_t,
+          TLAPACK_SMATRIX matrixT_t>
+int unmq_form_tt(direction_t direction,
+                 storage_t storeMode,
+                 const matrixV_t& V,
+                 const vector_t& tau,
+                 matrixT_t& TT)
+{
+    using idx_t = size_type<matrixV_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t k = size(tau);
+    const idx_t nQ = (storeMode == StoreV::Columnwise) ? nrows(V) : ncols(V);
+    const idx_t nb = min((idx_t)ncols(TT), k);
+
+    // check arguments
+    tlapack_check_false(direction != Direction::Backward &&
+                        direction != Direction::Forward);
+    tlapack_check_false(storeMode != StoreV::Columnwise &&
+                        storeMode != StoreV::Rowwise);
+    tlapack_check((storeMode == StoreV::Columnwise) ? (ncols(V) == k)
+                                                    : (nrows(V) == k));
+    tlapack_check((idx_t)nrows(TT) >= k);
+
+    // quick return
+    if (k <= 0) return 0;
+    tlapack_check(nb > 0);
+
+    const idx_t nblocks = (k + nb - 1) / nb;
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic) if (nblocks > 1)
+#endif
+    for (idx_t b = 0; b < nblocks; ++b) {
+        const idx_t i = b * nb;
+        const idx_t ib = min(nb, k - i);
+        const auto rangev = (direction == Direction::Forward)
+                                ? range{i, nQ}
+                                : range{0, nQ - k + i + ib};
+        const auto taui = slice(tau, range{i, i + ib});
+        auto Ti = slice(TT, range{i, i + ib}, range{0, ib});
+
+        if (storeMode == StoreV::Columnwise) {
+            const auto Vi = slice(V, rangev, range{i, i + ib});
+            larft(direction, COLUMNWISE_STORAGE, Vi, taui, Ti);
+        }
+        else {
+            const auto Vi = slice(V, range{i, i + ib}, rangev);
+            larft(direction, ROWWISE_STORAGE, Vi, taui, Ti);
+        }
+    }
+
+    return 0;
+}
+
+/** Worspace query of unmq_tt()
+ *
+ * @param[in] side Specifies which side op(Q) is to be applied.
+ *      - Side::Left:  C := op(Q) C;
+ *      - Side::Right: C := C op(Q).
+ *
+ * @param[in] trans The operation $op(Q)$ to be used:
+ *      - Op::NoTrans:      $op(Q) = Q$;
+ *      - Op::ConjTrans:    $op(Q) = Q^H$.
+ *
+ * @param[in] direction
+ *     Indicates how Q is formed from a product of elementary reflectors.
+ *
+ * @param[in] storeMode
+ *     Indicates how the vectors which define the elementary reflectors are
+ * stored.
+ *
+ * @param[in] V Matrix of reflectors, as in unmq().
+ *
+ * @param[in] TT k-by-nb matrix computed by unmq_form_tt().
+ *
+ * @param[in] C m-by-n matrix.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SMATRIX matrixV_t,
+          TLAPACK_SMATRIX matrixT_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_OP trans_t,
+          TLAPACK_DIRECTION direction_t,
+          TLAPACK_STOREV storage_t>
+constexpr WorkInfo unmq_tt_worksize(side_t side,
+                                    trans_t trans,
+                                    direction_t direction,
+                                    storage_t storeMode,
+                                    const matrixV_t& V,
+                                    const matrixT_t& TT,
+                                    const matrixC_t& C,
+                                    const UnmqOpts& opts = {})
+{
+    using idx_t = size_type<matrixC_t>;
+    using work_t = matrix_type<matrixV_t, matrixC_t>;
+
+    // constants
+    const idx_t m = nrows(C);
+    const idx_t n = ncols(C);
+    const idx_t k = nrows(TT);
+    const idx_t nb = min((idx_t)ncols(TT), k);
+
+    if constexpr (is_same_v<T, type_t<work_t>>)
+        return (side == Side::Left) ? WorkInfo(nb, n) : WorkInfo(m, nb);
+    else
+        return WorkInfo(0);
+}
+
+/** @copybrief unmq_tt()
+ * Workspace is provided as an argument.
+ * @copydetails unmq_tt()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixV_t,
+          TLAPACK_SMATRIX matrixT_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_OP trans_t,
+          TLAPACK_DIRECTION direction_t,
+          TLAPACK_STOREV storage_t,
+          TLAPACK_WORKSPACE work_t>
+int unmq_tt_work(side_t side,
+                 trans_t trans,
+                 direction_t direction,
+                 storage_t storeMode,
+                 const matrixV_t& V,
+                 const matrixT_t& TT,
+                 matrixC_t& C,
+                 work_t& work,
+                 const UnmqOpts& opts = {})
+{
+    using idx_t = size_type<matrixC_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(C);
+    const idx_t n = ncols(C);
+    const idx_t k = nrows(TT);
+    const idx_t nQ = (side == Side::Left) ? m : n;
+    const idx_t nb = min((idx_t)ncols(TT), k);
+
+    // check arguments
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(
+        trans != Op::NoTrans && trans != Op::ConjTrans &&
+        ((trans != Op::Trans) || is_complex<type_t<matrixV_t>>));
+    tlapack_check_false(direction != Direction::Backward &&
+                        direction != Direction::Forward);
+    tlapack_check((storeMode == StoreV::Columnwise)
+                      ? ((ncols(V) == k) && (nrows(V) == nQ))
+                      : ((nrows(V) == k) && (ncols(V) == nQ)));
+
+    // quick return
+    if (m <= 0 || n <= 0 || k <= 0) return 0;
+    tlapack_check(nb > 0);
+
+    // Matrix W
+    auto W = (side == Side::Left) ? reshape(work, nb, n).first
+                                  : reshape(work, m, nb).first;
+
+    // Order in which the blocks are applied
+    const bool positiveIncLeft =
+        (storeMode == StoreV::Columnwise)
+            ? ((direction == Direction::Backward) ? (trans == Op::NoTrans)
+                                                  : (trans != Op::NoTrans))
+            : ((direction == Direction::Forward) ? (trans == Op::NoTrans)
+                                                 : (trans != Op::NoTrans));
+    const bool positiveInc =
+        (side == Side::Left) ? positiveIncLeft : !positiveIncLeft;
+    const Op transH = (storeMode == StoreV::Columnwise)
+                          ? Op(trans)
+                          : ((trans == Op::NoTrans) ? Op::ConjTrans
+                                                    : Op::NoTrans);
+    const idx_t nblocks = (k + nb - 1) / nb;
+
+    // C is split into panels of at most nc columns (side = Side::Left) or nc
+    // rows (side = Side::Right), and each panel goes through all the blocks
+    // of reflectors. Different panels are in different stages of the
+    // pipeline at the same time.
+    const idx_t nC = (side == Side::Left) ? n : m;
+    const idx_t nc = (opts.nc > 0) ? min((idx_t)opts.nc, nC) : nC;
+    const idx_t npanels = (nC + nc - 1) / nc;
+
+#ifdef TLAPACK_USE_OPENMP
+#pragma omp parallel for schedule(dynamic) if (npanels > 1)
+#endif
+    for (idx_t p = 0; p < npanels; ++p) {
+        const range rangep{p * nc, min((p + 1) * nc, nC)};
+        for (idx_t b = 0; b < nblocks; ++b) {
+            const idx_t i = (positiveInc) ? b * nb : (nblocks - 1 - b) * nb;
+            const idx_t ib = min(nb, k - i);
+            const auto rangev = (direction == Direction::Forward)
+                                    ? range{i, nQ}
+                                    : range{0, nQ - k + i + ib};
+            const auto Ti = slice(TT, range{i, i + ib}, range{0, ib});
+
+            // H or H**H is applied to either C[i:m,p] or C[p,i:n]
+            auto Ci = (side == Side::Left) ? slice(C, rangev, rangep)
+                                           : slice(C, rangep, rangev);
+            auto Wi = (side == Side::Left)
+                          ? slice(W, range{0, ib}, rangep)
+                          : slice(W, rangep, range{0, ib});
+
+            if (storeMode == StoreV::Columnwise) {
+                const auto Vi = slice(V, rangev, range{i, i + ib});
+                internal::larfb_panel(side, transH, direction,
+                                      COLUMNWISE_STORAGE, Vi, Ti, Ci, Wi);
+            }
+            else {
+                const auto Vi = slice(V, range{i, i + ib}, rangev);
+                internal::larfb_panel(side, transH, direction,
+                                      ROWWISE_STORAGE, Vi, Ti, Ci, Wi);
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Applies unitary matrix Q to a matrix C using precomputed triangular
+ * factors.
+ *
+ * This routine computes the same as unmq(), but the triangular factors of
+ * the block reflectors are read from TT, as computed by unmq_form_tt(). When
+ * the same Q is applied to many matrices, the factors are formed only once.
+ *
+ * C is split into panels of at most opts.nc columns (side = Side::Left) or
+ * rows (side = Side::Right). Each panel is updated by all block reflectors
+ * before the next panel starts, so that it remains in cache. When <T>LAPACK
+ * is built with TLAPACK_USE_OPENMP, the panels are processed by different
+ * threads, and the application of one block to a panel overlaps with the
+ * application of other blocks to the other panels.
+ *
+ * @param[in] side Specifies which side op(Q) is to be applied.
+ *      - Side::Left:  C := op(Q) C;
+ *      - Side::Right: C := C op(Q).
+ *
+ * @param[in] trans The operation $op(Q)$ to be used:
+ *      - Op::NoTrans:      $op(Q) = Q$;
+ *      - Op::ConjTrans:    $op(Q) = Q^H$.
+ *      Op::Trans is a valid value if the data type of A is real. In this case,
+ *      the algorithm treats Op::Trans as Op::ConjTrans.
+ *
+ * @param[in] direction
+ *     Indicates how Q is formed from a product of elementary reflectors.
+ *     - Direction::Forward:  $Q = H_1 H_2 ... H_k$.
+ *     - Direction::Backward: $Q = H_k ... H_2 H_1$.
+ *
+ * @param[in] storeMode
+ *     Indicates how the vectors which define the elementary reflectors are
+ * stored:
+ *     - StoreV::Columnwise.
+ *     - StoreV::Rowwise.
+ *
+ * @param[in] V
+ *     - If storeMode = StoreV::Columnwise:
+ *       - if side = Side::Left,  the m-by-k matrix V;
+ *       - if side = Side::Right, the n-by-k matrix V.
+ *     - If storeMode = StoreV::Rowwise:
+ *       - if side = Side::Left,  the k-by-m matrix V;
+ *       - if side = Side::Right, the k-by-n matrix V.
+ *
+ * @param[in] TT k-by-nb matrix.
+ *      The triangular factors of the block reflectors, computed by
+ *      unmq_form_tt() with the same V, direction and storeMode.
+ *
+ * @param[in,out] C m-by-n matrix.
+ *      On exit, C is replaced by op(Q) C or C op(Q).
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nc: Maximum size of the panels of C.
+ *      - @c opts.nb is not referenced. The block size is ncols(TT).
+ *
+ * @return 0 if success.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrixV_t,
+          TLAPACK_SMATRIX matrixT_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_OP trans_t,
+          TLAPACK_DIRECTION direction_t,
+          TLAPACK_STOREV storage_t>
+int unmq_tt(side_t side,
+            trans_t trans,
+            direction_t direction,
+            storage_t storeMode,
+            const matrixV_t& V,
+            const matrixT_t& TT,
+            matrixC_t& C,
+            const UnmqOpts& opts = {})
+{
+    using work_t = matrix_type<matrixV_t, matrixC_t>;
+    using T = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = unmq_tt_worksize<T>(side, trans, direction, storeMode,
+                                            V, TT, C, opts);
+    std::vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return unmq_tt_work(side, trans, direction, storeMode, V, TT, C, work,
+                        opts);
+}
+
 }  // namespace tlapack
 
 #endif  // TLAPACK_UNMQ_HH
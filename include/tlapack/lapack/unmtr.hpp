@@ -0,0 +1,231 @@
+/// @file unmtr.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zunmtr.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_UNMTR_HH
+#define TLAPACK_UNMTR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/unmq.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for unmtr
+ */
+struct UnmtrOpts {
+    size_t nb = 32;  ///< Block size
+};
+
+/** Worspace query of unmtr()
+ *
+ * @param[in] side Specifies which side op(Q) is to be applied.
+ *      - Side::Left:  C := op(Q) C;
+ *      - Side::Right: C := C op(Q).
+ *
+ * @param[in] uplo
+ *      Must have the same value as in the previous call to hetrd.
+ *
+ * @param[in] trans The operation $op(Q)$ to be used:
+ *      - Op::NoTrans:      $op(Q) = Q$;
+ *      - Op::ConjTrans:    $op(Q) = Q^H$.
+ *      Op::Trans is a valid value if the data type of A is real. In this case,
+ *      the algorithm treats Op::Trans as Op::ConjTrans.
+ *
+ * @param[in] A nQ-by-nQ matrix.
+ *      Matrix containing the elementary reflectors, as returned by hetrd.
+ *
+ * @param[in] tau Vector of length nQ-1.
+ *      Scalar factors of the elementary reflectors.
+ *
+ * @param[in] C m-by-n matrix.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SVECTOR vector_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_UPLO uplo_t,
+          TLAPACK_OP trans_t>
+constexpr WorkInfo unmtr_worksize(side_t side,
+                                  uplo_t uplo,
+                                  trans_t trans,
+                                  const matrixA_t& A,
+                                  const vector_t& tau,
+                                  const matrixC_t& C,
+                                  const UnmtrOpts& opts = {})
+{
+    using idx_t = size_type<matrixC_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(C);
+    const idx_t n = ncols(C);
+    const idx_t nQ = (side == Side::Left) ? m : n;
+
+    if (nQ <= 1) return WorkInfo(0);
+
+    // Rows (or columns) of C transformed by Q
+    const range rQ = (uplo == Uplo::Upper) ? range{0, nQ - 1} : range{1, nQ};
+
+    auto&& tau_s = slice(tau, range{0, nQ - 1});
+    auto&& C_s = (side == Side::Left) ? slice(C, rQ, range{0, n})
+                                      : slice(C, range{0, m}, rQ);
+    if (uplo == Uplo::Upper) {
+        auto&& V = slice(A, range{0, nQ - 1}, range{1, nQ});
+        return unmq_worksize<T>(side, trans, BACKWARD, COLUMNWISE_STORAGE, V,
+                                tau_s, C_s, UnmqOpts{opts.nb});
+    }
+    else {
+        auto&& V = slice(A, range{1, nQ}, range{0, nQ - 1});
+        return unmq_worksize<T>(side, trans, FORWARD, COLUMNWISE_STORAGE, V,
+                                tau_s, C_s, UnmqOpts{opts.nb});
+    }
+}
+
+/** @copybrief unmtr()
+ * Workspace is provided as an argument.
+ * @copydetails unmtr()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SVECTOR vector_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_UPLO uplo_t,
+          TLAPACK_OP trans_t,
+          TLAPACK_WORKSPACE work_t>
+int unmtr_work(side_t side,
+               uplo_t uplo,
+               trans_t trans,
+               const matrixA_t& A,
+               const vector_t& tau,
+               matrixC_t& C,
+               work_t& work,
+               const UnmtrOpts& opts = {})
+{
+    using idx_t = size_type<matrixC_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(C);
+    const idx_t n = ncols(C);
+    const idx_t nQ = (side == Side::Left) ? m : n;
+
+    // check arguments
+    tlapack_check(side == Side::Left || side == Side::Right);
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(nrows(A) == nQ && ncols(A) == nQ);
+
+    // quick return
+    if (nQ <= 1) return 0;
+
+    // Q is equal to the identity in its first (uplo = Lower) or last
+    // (uplo = Upper) row and column. The corresponding row or column of C is
+    // left untouched.
+    const range rQ = (uplo == Uplo::Upper) ? range{0, nQ - 1} : range{1, nQ};
+
+    const auto tau_s = slice(tau, range{0, nQ - 1});
+    auto C_s = (side == Side::Left) ? slice(C, rQ, range{0, n})
+                                    : slice(C, range{0, m}, rQ);
+    if (uplo == Uplo::Upper) {
+        const auto V = slice(A, range{0, nQ - 1}, range{1, nQ});
+        return unmq_work(side, trans, BACKWARD, COLUMNWISE_STORAGE, V, tau_s,
+                         C_s, work, UnmqOpts{opts.nb});
+    }
+    else {
+        const auto V = slice(A, range{1, nQ}, range{0, nQ - 1});
+        return unmq_work(side, trans, FORWARD, COLUMNWISE_STORAGE, V, tau_s,
+                         C_s, work, UnmqOpts{opts.nb});
+    }
+}
+
+/** Applies the unitary matrix Q from hetrd() to a matrix C.
+ *
+ * - side = Side::Left  & trans = Op::NoTrans:    $C := Q C$;
+ * - side = Side::Right & trans = Op::NoTrans:    $C := C Q$;
+ * - side = Side::Left  & trans = Op::ConjTrans:  $C := Q^H C$;
+ * - side = Side::Right & trans = Op::ConjTrans:  $C := C Q^H$.
+ *
+ * Q is the nQ-by-nQ unitary matrix, with nQ = m if side = Side::Left and
+ * nQ = n if side = Side::Right, defined as the product of nQ-1 elementary
+ * reflectors returned by hetrd(). Q is applied with the blocked routine
+ * unmq().
+ *
+ * @param[in] side Specifies which side op(Q) is to be applied.
+ *      - Side::Left:  C := op(Q) C;
+ *      - Side::Right: C := C op(Q).
+ *
+ * @param[in] uplo
+ *      Must have the same value as in the previous call to hetrd.
+ *      - Uplo::Upper: Q = H(nQ-2) . . . H(1) H(0);
+ *      - Uplo::Lower: Q = H(0) H(1) . . . H(nQ-2).
+ *
+ * @param[in] trans The operation $op(Q)$ to be used:
+ *      - Op::NoTrans:      $op(Q) = Q$;
+ *      - Op::ConjTrans:    $op(Q) = Q^H$.
+ *      Op::Trans is a valid value if the data type of A is real. In this case,
+ *      the algorithm treats Op::Trans as Op::ConjTrans.
+ *
+ * @param[in] A nQ-by-nQ matrix.
+ *      Matrix containing the elementary reflectors, as returned by hetrd.
+ *
+ * @param[in] tau Vector of length nQ-1.
+ *      Scalar factors of the elementary reflectors.
+ *
+ * @param[in,out] C m-by-n matrix.
+ *      On exit, C is overwritten by op(Q) C or C op(Q).
+ *
+ * @param[in] opts Options.
+ *
+ * @return 0 if success.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SVECTOR vector_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_UPLO uplo_t,
+          TLAPACK_OP trans_t>
+int unmtr(side_t side,
+          uplo_t uplo,
+          trans_t trans,
+          const matrixA_t& A,
+          const vector_t& tau,
+          matrixC_t& C,
+          const UnmtrOpts& opts = {})
+{
+    using work_t = matrix_type<matrixA_t, vector_t>;
+    using T = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = unmtr_worksize<T>(side, uplo, trans, A, tau, C, opts);
+    std::vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return unmtr_work(side, uplo, trans, A, tau, C, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_UNMTR_HH
@@ -0,0 +1,129 @@
+/// @file test_compact_wy.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the compact WY representation of Q
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/compact_wy.hpp>
+#include <tlapack/lapack/gelq2.hpp>
+#include <tlapack/lapack/geql2.hpp>
+#include <tlapack/lapack/geqr2.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Compact WY representation of Q",
+                   "[compact_wy]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = 15;
+    const idx_t k = GENERATE(1, 8, 15);
+    const idx_t nb = GENERATE(2, 5);
+    const int fact = GENERATE(0, 1, 2);  // QR, QL or LQ
+
+    const Direction direction =
+        (fact == 1) ? Direction::Backward : Direction::Forward;
+    const StoreV storeMode =
+        (fact == 2) ? StoreV::Rowwise : StoreV::Columnwise;
+
+    const real_t eps = ulp<real_t>();
+    const real_t tol = real_t(100.0 * m) * eps;
+
+    // Reflectors from a QR, QL or LQ factorization
+    std::vector<T> A_;
+    auto A = (fact == 2) ? new_matrix(A_, k, m) : new_matrix(A_, m, k);
+    std::vector<T> tau(k);
+    mm.random(A);
+    if (fact == 0)
+        geqr2(A, tau);
+    else if (fact == 1)
+        geql2(A, tau);
+    else
+        gelq2(A, tau);
+
+    DYNAMIC_SECTION("fact = " << fact << " k = " << k << " nb = " << nb)
+    {
+        UnmqOpts opts;
+        opts.nb = nb;
+        opts.nc = 4;
+        CompactWY<matrix_t> Q(direction, storeMode, A, tau, opts);
+        REQUIRE(Q.nQ() == m);
+
+        // Explicit Q
+        std::vector<T> Qm_;
+        auto Qm = new_matrix(Qm_, m, m);
+        Q.form_q(Qm);
+
+        // Q^H Q - I
+        std::vector<T> R_;
+        auto R = new_matrix(R_, m, m);
+        laset(GENERAL, T(0), T(1), R);
+        gemm(CONJ_TRANS, NO_TRANS, real_t(1), Qm, Qm, real_t(-1), R);
+        CHECK(lange(MAX_NORM, R) <= tol);
+
+        // apply() agrees with unmq() and with the explicit Q
+        for (const Side side : {Side::Left, Side::Right}) {
+            for (const Op trans : {Op::NoTrans, Op::ConjTrans}) {
+                const idx_t mc = (side == Side::Left) ? m : 6;
+                const idx_t nc = (side == Side::Left) ? 6 : m;
+
+                std::vector<T> C_;
+                auto C = new_matrix(C_, mc, nc);
+                std::vector<T> C0_;
+                auto C0 = new_matrix(C0_, mc, nc);
+                std::vector<T> Cq_;
+                auto Cq = new_matrix(Cq_, mc, nc);
+                mm.random(C0);
+                lacpy(GENERAL, C0, C);
+                lacpy(GENERAL, C0, Cq);
+
+                Q.apply(side, trans, C);
+                unmq(side, trans, direction, storeMode, A, tau, Cq, opts);
+                for (idx_t j = 0; j < nc; ++j)
+                    for (idx_t i = 0; i < mc; ++i)
+                        Cq(i, j) -= C(i, j);
+                CHECK(lange(MAX_NORM, Cq) <= tol);
+
+                if (side == Side::Left)
+                    gemm(trans, NO_TRANS, real_t(1), Qm, C0, real_t(-1), C);
+                else
+                    gemm(NO_TRANS, trans, real_t(1), C0, Qm, real_t(-1), C);
+                CHECK(lange(MAX_NORM, C) <= tol);
+            }
+        }
+
+        // Leading columns of Q
+        const idx_t nq = (m + 1) / 2;
+        std::vector<T> Q1_;
+        auto Q1 = new_matrix(Q1_, m, nq);
+        Q.form_q(Q1);
+        for (idx_t j = 0; j < nq; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                Q1(i, j) -= Qm(i, j);
+        CHECK(lange(MAX_NORM, Q1) <= tol);
+    }
+}
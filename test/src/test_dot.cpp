@@ -0,0 +1,85 @@
+/// @file test_dot.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test that the reductions do not depend on the storage of the vectors
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/asum.hpp>
+#include <tlapack/blas/dot.hpp>
+#include <tlapack/blas/dotu.hpp>
+
+using namespace tlapack;
+
+#define TEST_TYPES_DOT \
+    float, double, std::complex<float>, std::complex<double>
+
+TEMPLATE_TEST_CASE(
+    "dot, dotu and asum give the same result for any storage of the vectors",
+    "[dot][dotu][asum][blas]",
+    TEST_TYPES_DOT)
+{
+    using T = TestType;
+    using idx_t = std::ptrdiff_t;
+    using range = pair<idx_t, idx_t>;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // n is not a multiple of the four partial sums of internal::dot4
+    const idx_t n = GENERATE(1, 5, 103);
+
+    std::vector<T> x(n), y(n);
+    for (idx_t i = 0; i < n; ++i)
+        x[i] = rand_helper<T>(mm.gen);
+    for (idx_t i = 0; i < n; ++i)
+        y[i] = rand_helper<T>(mm.gen);
+
+    // Strided storage: rows of a column-major matrix
+    const idx_t ldim = 3;
+    std::vector<T> S_(ldim * n);
+    LegacyMatrix<T, idx_t> S(2, n, S_.data(), ldim);
+    for (idx_t j = 0; j < n; ++j) {
+        S(0, j) = x[j];
+        S(1, j) = y[j];
+    }
+    const auto xs = slice(S, 0, range{0, n});
+    const auto ys = slice(S, 1, range{0, n});
+
+    // Generic storage: vectors stored backwards, which are accessed through
+    // their operator[]
+    using backward_t = LegacyVector<T, idx_t, idx_t, Direction::Backward>;
+    std::vector<T> xb_(x.rbegin(), x.rend()), yb_(y.rbegin(), y.rend());
+    const backward_t xb(n, xb_.data());
+    const backward_t yb(n, yb_.data());
+    for (idx_t i = 0; i < n; ++i) {
+        REQUIRE(xb[i] == x[i]);
+        REQUIRE(yb[i] == y[i]);
+    }
+
+    DYNAMIC_SECTION("n = " << n)
+    {
+        const auto d = dot(x, y);
+        CHECK(dot(xs, ys) == d);
+        CHECK(dot(xb, yb) == d);
+        CHECK(dot(x, ys) == d);
+        CHECK(dot(xb, y) == d);
+
+        const auto du = dotu(x, y);
+        CHECK(dotu(xs, ys) == du);
+        CHECK(dotu(xb, yb) == du);
+        CHECK(dotu(x, ys) == du);
+        CHECK(dotu(xb, y) == du);
+
+        const auto s = asum(x);
+        CHECK(asum(xs) == s);
+        CHECK(asum(xb) == s);
+    }
+}
@@ -0,0 +1,174 @@
+/// @file test_gemm.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test gemm with accumulators of a wider type
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+
+using namespace tlapack;
+
+// Pairs (type of the matrices, type of the accumulators)
+#ifdef TLAPACK_TEST_EIGEN
+    #define TEST_TYPES_GEMM                                        \
+        (std::pair<float, double>),                                \
+            (std::pair<std::complex<float>, std::complex<double>>), \
+            (std::pair<Eigen::half, float>)
+#else
+    #define TEST_TYPES_GEMM         \
+        (std::pair<float, double>), \
+            (std::pair<std::complex<float>, std::complex<double>>)
+#endif
+
+TEMPLATE_TEST_CASE("gemm with GemmOpts accumulates in the type accum_t",
+                   "[gemm][blas]",
+                   TEST_TYPES_GEMM)
+{
+    using T = typename TestType::first_type;
+    using accum_t = typename TestType::second_type;
+    using real_t = real_type<T>;
+    using matrix_t = LegacyMatrix<T, size_t>;
+    using idx_t = size_type<matrix_t>;
+
+    // Reference type and conversions
+    using ref_t =
+        std::conditional_t<is_complex<T>, std::complex<double>, double>;
+    auto to_ref = [](const T& x) -> ref_t {
+        if constexpr (is_complex<T>)
+            return ref_t(double(real(x)), double(imag(x)));
+        else
+            return ref_t(double(x));
+    };
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<LegacyMatrix<ref_t, size_t>> new_ref_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Op transA = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const Op transB = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const idx_t m = GENERATE(1, 13);
+    const idx_t n = GENERATE(9, 16);
+    const idx_t k = GENERATE(0, 1, 30, 300);
+    const bool use_beta = GENERATE(true, false);
+    const bool use_work = GENERATE(true, false);
+
+    // Block sizes that do not divide m, n or k
+    GemmOpts<accum_t> opts;
+    opts.mb = 7;
+    opts.nb = 5;
+    opts.kb = 11;
+
+    const T alpha = T(0.5f);
+    const T beta = T(-0.25f);
+
+    const idx_t ma = (transA == Op::NoTrans) ? m : k;
+    const idx_t na = (transA == Op::NoTrans) ? k : m;
+    const idx_t mb = (transB == Op::NoTrans) ? k : n;
+    const idx_t nb = (transB == Op::NoTrans) ? n : k;
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, ma, na);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, mb, nb);
+    std::vector<T> C_;
+    auto C = new_matrix(C_, m, n);
+    mm.random(A);
+    mm.random(B);
+    mm.random(C);
+
+    // Reference product in double precision and bound for the sum of the
+    // absolute values of the terms
+    std::vector<ref_t> Aref_;
+    auto Aref = new_ref_matrix(Aref_, ma, na);
+    std::vector<ref_t> Bref_;
+    auto Bref = new_ref_matrix(Bref_, mb, nb);
+    std::vector<ref_t> Cref_;
+    auto Cref = new_ref_matrix(Cref_, m, n);
+    for (idx_t j = 0; j < na; ++j)
+        for (idx_t i = 0; i < ma; ++i)
+            Aref(i, j) = to_ref(A(i, j));
+    for (idx_t j = 0; j < nb; ++j)
+        for (idx_t i = 0; i < mb; ++i)
+            Bref(i, j) = to_ref(B(i, j));
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            Cref(i, j) = (use_beta) ? to_ref(C(i, j)) : ref_t(0);
+    gemm(transA, transB, to_ref(alpha), Aref, Bref, to_ref(beta), Cref);
+
+    std::vector<double> absA_;
+    auto absA = new_ref_matrix(absA_, ma, na);
+    std::vector<double> absB_;
+    auto absB = new_ref_matrix(absB_, mb, nb);
+    std::vector<double> absC_;
+    auto absC = new_ref_matrix(absC_, m, n);
+    for (idx_t j = 0; j < na; ++j)
+        for (idx_t i = 0; i < ma; ++i)
+            absA(i, j) = abs(Aref(i, j));
+    for (idx_t j = 0; j < nb; ++j)
+        for (idx_t i = 0; i < mb; ++i)
+            absB(i, j) = abs(Bref(i, j));
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            absC(i, j) = (use_beta) ? abs(to_ref(C(i, j))) : 0.0;
+    const Op opA = (transA == Op::NoTrans) ? Op::NoTrans : Op::Trans;
+    const Op opB = (transB == Op::NoTrans) ? Op::NoTrans : Op::Trans;
+    gemm(opA, opB, abs(to_ref(alpha)), absA, absB, abs(to_ref(beta)), absC);
+
+    DYNAMIC_SECTION("transA = " << transA << " transB = " << transB
+                                << " m = " << m << " n = " << n << " k = " << k
+                                << " beta = " << use_beta
+                                << " work = " << use_work)
+    {
+        if (use_work) {
+            WorkInfo workinfo = (use_beta)
+                                    ? gemm_worksize<accum_t>(transA, transB,
+                                                             alpha, A, B, beta,
+                                                             C, opts)
+                                    : gemm_worksize<accum_t>(
+                                          transA, transB, alpha, A, B,
+                                          StrongZero(), C, opts);
+            std::vector<accum_t> work_;
+            auto work = Create<LegacyMatrix<accum_t, size_t>>()(
+                work_, workinfo.m, workinfo.n);
+            if (use_beta)
+                gemm_work(transA, transB, alpha, A, B, beta, C, work, opts);
+            else
+                gemm_work(transA, transB, alpha, A, B, StrongZero(), C, work,
+                          opts);
+        }
+        else {
+            if (use_beta)
+                gemm(transA, transB, alpha, A, B, beta, C, opts);
+            else
+                gemm(transA, transB, alpha, A, B, StrongZero(), C, opts);
+        }
+
+        // The only rounding error in the type T is the one of the final
+        // conversion. The error of the accumulation in accum_t is bounded by
+        // (k + 2) u_accum (|alpha| |op(A)| |op(B)| + |beta| |C|). The unit
+        // roundoffs are computed from the number of digits, since
+        // numeric_limits<Eigen::half>::epsilon() is not 2^(1-digits).
+        const double uT = std::ldexp(1.0, -digits<real_t>());
+        const double uAcc = std::ldexp(1.0, -digits<real_type<accum_t>>());
+        const double tiny = double(safe_min<real_t>());
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < m; ++i) {
+                const double err = abs(to_ref(C(i, j)) - Cref(i, j));
+                const double bound = 2 * uT * abs(Cref(i, j)) +
+                                     2 * (k + 2) * uAcc * absC(i, j) + tiny;
+                CHECK(err <= bound);
+            }
+        }
+    }
+}
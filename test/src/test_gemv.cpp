@@ -0,0 +1,80 @@
+/// @file test_gemv.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the general matrix-vector product
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/gemv.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("gemv agrees with the naive product",
+                   "[gemv][blas]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans, Op::Conj);
+    // The last pair is above internal::matvec_parallel_min
+    const auto [m, n] = GENERATE(std::pair<idx_t, idx_t>{1, 1},
+                                 std::pair<idx_t, idx_t>{7, 300},
+                                 std::pair<idx_t, idx_t>{300, 7},
+                                 std::pair<idx_t, idx_t>{300, 301});
+
+    const T alpha = T(0.5f);
+    const T beta = T(-0.25f);
+
+    const bool noTrans = (trans == Op::NoTrans || trans == Op::Conj);
+    const idx_t ma = noTrans ? m : n;
+    const idx_t na = noTrans ? n : m;
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, ma, na);
+    std::vector<T> x(n), y(m), yref(m);
+    std::vector<real_t> ybound(m);
+    mm.random(A);
+    for (idx_t j = 0; j < n; ++j)
+        x[j] = rand_helper<T>(mm.gen);
+    for (idx_t i = 0; i < m; ++i)
+        y[i] = rand_helper<T>(mm.gen);
+
+    // Naive product and bound for the sum of the absolute values of the terms
+    for (idx_t i = 0; i < m; ++i) {
+        T sum(0);
+        real_t sumabs(0);
+        for (idx_t j = 0; j < n; ++j) {
+            T a = noTrans ? A(i, j) : A(j, i);
+            if (trans == Op::ConjTrans || trans == Op::Conj) a = conj(a);
+            sum += a * x[j];
+            sumabs += abs(a) * abs(x[j]);
+        }
+        yref[i] = alpha * sum + beta * y[i];
+        ybound[i] = abs(alpha) * sumabs + abs(beta) * abs(y[i]);
+    }
+
+    DYNAMIC_SECTION("trans = " << trans << " m = " << m << " n = " << n)
+    {
+        gemv(trans, alpha, A, x, beta, y);
+
+        const real_t tol = real_t(2 * (n + 2)) * ulp<real_t>();
+        for (idx_t i = 0; i < m; ++i)
+            CHECK(abs(y[i] - yref[i]) <= tol * ybound[i]);
+    }
+}
@@ -0,0 +1,173 @@
+/// @file test_gemv2.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the fused pairs of matrix-vector products and rank-1 updates
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/gemv2.hpp>
+#include <tlapack/blas/ger2.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("gemv2 agrees with the naive products",
+                   "[gemv2][blas]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Op trans1 = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans, Op::Conj);
+    const Op trans2 = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans, Op::Conj);
+    const auto [m, n] = GENERATE(std::pair<idx_t, idx_t>{1, 1},
+                                 std::pair<idx_t, idx_t>{7, 30},
+                                 std::pair<idx_t, idx_t>{30, 7});
+    const bool use_beta = GENERATE(true, false);
+
+    const T alpha = T(0.5f);
+    const T beta = T(-0.25f);
+
+    const bool noTrans1 = (trans1 == Op::NoTrans || trans1 == Op::Conj);
+    const bool noTrans2 = (trans2 == Op::NoTrans || trans2 == Op::Conj);
+    const idx_t n1 = noTrans1 ? n : m;
+    const idx_t m1 = noTrans1 ? m : n;
+    const idx_t n2 = noTrans2 ? n : m;
+    const idx_t m2 = noTrans2 ? m : n;
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> x1(n1), x2(n2), y1(m1), y2(m2);
+    mm.random(A);
+    for (idx_t j = 0; j < n1; ++j)
+        x1[j] = rand_helper<T>(mm.gen);
+    for (idx_t j = 0; j < n2; ++j)
+        x2[j] = rand_helper<T>(mm.gen);
+    for (idx_t i = 0; i < m1; ++i)
+        y1[i] = rand_helper<T>(mm.gen);
+    for (idx_t i = 0; i < m2; ++i)
+        y2[i] = rand_helper<T>(mm.gen);
+
+    // Naive product alpha op(A) x + beta y, and bound for the sum of the
+    // absolute values of its terms
+    auto naive = [&](Op trans, const std::vector<T>& x,
+                     const std::vector<T>& y, std::vector<T>& yref,
+                     std::vector<real_t>& ybound) {
+        const bool noTrans = (trans == Op::NoTrans || trans == Op::Conj);
+        const idx_t my = size(y);
+        const idx_t nx = size(x);
+        yref.resize(my);
+        ybound.resize(my);
+        for (idx_t i = 0; i < my; ++i) {
+            T sum(0);
+            real_t sumabs(0);
+            for (idx_t j = 0; j < nx; ++j) {
+                T a = noTrans ? A(i, j) : A(j, i);
+                if (trans == Op::ConjTrans || trans == Op::Conj) a = conj(a);
+                sum += a * x[j];
+                sumabs += abs(a) * abs(x[j]);
+            }
+            yref[i] = alpha * sum;
+            ybound[i] = abs(alpha) * sumabs;
+            if (use_beta) {
+                yref[i] += beta * y[i];
+                ybound[i] += abs(beta) * abs(y[i]);
+            }
+        }
+    };
+    std::vector<T> y1ref, y2ref;
+    std::vector<real_t> y1bound, y2bound;
+    naive(trans1, x1, y1, y1ref, y1bound);
+    naive(trans2, x2, y2, y2ref, y2bound);
+
+    DYNAMIC_SECTION("trans1 = " << trans1 << " trans2 = " << trans2
+                                << " m = " << m << " n = " << n
+                                << " beta = " << use_beta)
+    {
+        if (use_beta)
+            gemv2(trans1, trans2, alpha, A, x1, x2, beta, y1, y2);
+        else
+            gemv2(trans1, trans2, alpha, A, x1, x2, y1, y2);
+
+        const real_t tol = real_t(2 * (max(m, n) + 2)) * ulp<real_t>();
+        for (idx_t i = 0; i < m1; ++i)
+            CHECK(abs(y1[i] - y1ref[i]) <= tol * y1bound[i]);
+        for (idx_t i = 0; i < m2; ++i)
+            CHECK(abs(y2[i] - y2ref[i]) <= tol * y2bound[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE("ger2 agrees with the naive rank-2 update",
+                   "[ger2][blas]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // The last pair is above internal::matvec_parallel_min
+    const auto [m, n] = GENERATE(std::pair<idx_t, idx_t>{1, 1},
+                                 std::pair<idx_t, idx_t>{7, 30},
+                                 std::pair<idx_t, idx_t>{300, 301});
+
+    const T alpha1 = T(0.5f);
+    const T alpha2 = T(-0.25f);
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> Aref_;
+    auto Aref = new_matrix(Aref_, m, n);
+    std::vector<T> x1(m), x2(m), y1(n), y2(n);
+    mm.random(A);
+    for (idx_t i = 0; i < m; ++i)
+        x1[i] = rand_helper<T>(mm.gen);
+    for (idx_t i = 0; i < m; ++i)
+        x2[i] = rand_helper<T>(mm.gen);
+    for (idx_t j = 0; j < n; ++j)
+        y1[j] = rand_helper<T>(mm.gen);
+    for (idx_t j = 0; j < n; ++j)
+        y2[j] = rand_helper<T>(mm.gen);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            Aref(i, j) = A(i, j) + alpha1 * x1[i] * conj(y1[j]) +
+                         alpha2 * x2[i] * conj(y2[j]);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n)
+    {
+        std::vector<real_t> bound(m * n);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                bound[i + j * m] = abs(A(i, j)) +
+                                   abs(alpha1) * abs(x1[i]) * abs(y1[j]) +
+                                   abs(alpha2) * abs(x2[i]) * abs(y2[j]);
+
+        ger2(alpha1, x1, y1, alpha2, x2, y2, A);
+
+        const real_t tol = real_t(8) * ulp<real_t>();
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(abs(A(i, j) - Aref(i, j)) <= tol * bound[i + j * m]);
+    }
+}
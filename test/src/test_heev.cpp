@@ -0,0 +1,136 @@
+/// @file test_heev.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the Hermitian eigensolver
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/heev.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Hermitian eigensolver is backward stable",
+                   "[eigenvalues][hermitian]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = GENERATE(1, 2, 9, 40, 70);
+    const EigenRange erange =
+        GENERATE(EigenRange::All, EigenRange::Index, EigenRange::Value);
+    const bool want_z = GENERATE(true, false);
+
+    const real_t zero(0);
+    const real_t one(1);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = real_t(n * 1.0e2) * eps;
+
+    // Define the matrices and vectors
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> H_;
+    auto H = new_matrix(H_, n, n);
+    std::vector<T> Z_;
+    auto Z = new_matrix(Z_, n, n);
+    std::vector<real_t> w(n);
+    std::vector<real_t> wall(n);
+
+    // Random Hermitian matrix
+    mm.random(A);
+    for (idx_t j = 0; j < n; ++j) {
+        A(j, j) = real(A(j, j));
+        for (idx_t i = j + 1; i < n; ++i)
+            A(i, j) = conj(A(j, i));
+    }
+    const real_t normA = lange(FROB_NORM, A);
+
+    // Reference eigenvalues
+    idx_t m;
+    lacpy(GENERAL, A, H);
+    REQUIRE(heev(false, uplo, H, wall, Z, m) == 0);
+    REQUIRE(m == n);
+
+    DYNAMIC_SECTION("uplo = " << uplo << " n = " << n
+                              << " range = " << (char)erange
+                              << " want_z = " << want_z)
+    {
+        // Select the eigenvalues il to iu-1
+        const idx_t il = n / 4;
+        const idx_t iu = max(il + 1, 3 * n / 4);
+
+        HeevOpts opts;
+        opts.range = erange;
+        opts.nb = 4;
+        opts.nx_switch = 8;
+        opts.smlsiz = 5;
+        if (erange == EigenRange::Index) {
+            opts.il = il;
+            opts.iu = iu;
+        }
+        else if (erange == EigenRange::Value) {
+            opts.vl = (il > 0) ? double(wall[il - 1] + wall[il]) / 2
+                               : double(wall[0] - one);
+            opts.vu = (iu < n) ? double(wall[iu - 1] + wall[iu]) / 2
+                               : double(wall[n - 1] + one);
+        }
+        const idx_t ilo = (erange == EigenRange::All) ? 0 : il;
+        const idx_t mexp = (erange == EigenRange::All) ? n : iu - il;
+
+        lacpy(GENERAL, A, H);
+        int info = heev(want_z, uplo, H, w, Z, m, opts);
+        REQUIRE(info == 0);
+        REQUIRE(m == mexp);
+
+        // The eigenvalues are in ascending order and agree with the
+        // reference
+        for (idx_t i = 0; i + 1 < m; ++i)
+            CHECK(w[i] <= w[i + 1]);
+        for (idx_t i = 0; i < m; ++i)
+            CHECK(abs(w[i] - wall[ilo + i]) <= tol * max(one, normA));
+
+        if (want_z) {
+            auto Zm = slice(Z, range{0, n}, range{0, m});
+
+            // Z**H * Z - I
+            std::vector<T> ZZ_;
+            auto ZZ = new_matrix(ZZ_, m, m);
+            laset(GENERAL, zero, one, ZZ);
+            gemm(CONJ_TRANS, NO_TRANS, one, Zm, Zm, -one, ZZ);
+            CHECK(lange(FROB_NORM, ZZ) <= tol);
+
+            // A * Z - Z * diag(w)
+            std::vector<T> R_;
+            auto R = new_matrix(R_, n, m);
+            for (idx_t j = 0; j < m; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    R(i, j) = Zm(i, j) * w[j];
+            gemm(NO_TRANS, NO_TRANS, one, A, Zm, -one, R);
+            CHECK(lange(FROB_NORM, R) <= tol * max(one, normA));
+        }
+    }
+}
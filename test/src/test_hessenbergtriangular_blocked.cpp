@@ -41,8 +41,9 @@ TEMPLATE_TEST_CASE(
     MatrixMarket mm;
 
     const std::string matrix_type = GENERATE("Random", "Near_overflow");
-    const idx_t n = GENERATE(1, 2, 3, 5, 10);
-    const idx_t nb = GENERATE(1, 2, 3);
+    const idx_t n = GENERATE(1, 2, 3, 5, 10, 30);
+    const idx_t nb = GENERATE(1, 2, 3, 8);
+    const idx_t nc = GENERATE(4, 256);
     const idx_t ilo_offset = GENERATE(0, 1);
     const idx_t ihi_offset = GENERATE(0, 1);
 
@@ -114,10 +115,12 @@ TEMPLATE_TEST_CASE(
     laset(GENERAL, (TA)0, (TA)1, Z);
 
     DYNAMIC_SECTION("matrix = " << matrix_type << " n = " << n << " ilo = "
-                                << ilo << " ihi = " << ihi << " nb = " << nb)
+                                << ilo << " ihi = " << ihi << " nb = " << nb
+                                << " nc = " << nc)
     {
         Gghd3Opts opts;
         opts.nb = nb;
+        opts.nc = nc;
         gghd3(true, true, ilo, ihi, H, T, Q, Z, opts);
 
         // Check orthogonality
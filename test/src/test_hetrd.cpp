@@ -0,0 +1,117 @@
+/// @file test_hetrd.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the reduction of a Hermitian matrix to tridiagonal form
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/lapack/hetrd.hpp>
+#include <tlapack/lapack/unmtr.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Tridiagonal reduction is backward stable",
+                   "[eigenvalues][hermitian]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = GENERATE(1, 2, 3, 10, 33);
+    const idx_t nb = GENERATE(1, 4, 32);
+    const idx_t nx = GENERATE(1, 6);
+
+    const real_t zero(0);
+    const real_t one(1);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = real_t(n * 1.0e2) * eps;
+
+    // Define the matrices and vectors
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> H_;
+    auto H = new_matrix(H_, n, n);
+    std::vector<T> Q_;
+    auto Q = new_matrix(Q_, n, n);
+    std::vector<T> TT_;
+    auto TT = new_matrix(TT_, n, n);
+    std::vector<T> tau(max<idx_t>(1, n - 1));
+
+    // Random Hermitian matrix
+    mm.random(A);
+    for (idx_t j = 0; j < n; ++j) {
+        A(j, j) = real(A(j, j));
+        for (idx_t i = j + 1; i < n; ++i)
+            A(i, j) = conj(A(j, i));
+    }
+    lacpy(GENERAL, A, H);
+
+    DYNAMIC_SECTION("uplo = " << uplo << " n = " << n << " nb = " << nb
+                              << " nx = " << nx)
+    {
+        HetrdOpts opts;
+        opts.nb = nb;
+        opts.nx_switch = nx;
+        int info = hetrd(uplo, H, tau, opts);
+        CHECK(info == 0);
+
+        // Generate Q
+        laset(GENERAL, zero, one, Q);
+        unmtr(LEFT_SIDE, uplo, NO_TRANS, H, tau, Q);
+
+        // Build the tridiagonal matrix T
+        laset(GENERAL, zero, zero, TT);
+        for (idx_t i = 0; i < n; ++i) {
+            CHECK(imag(H(i, i)) == zero);
+            TT(i, i) = H(i, i);
+        }
+        for (idx_t i = 0; i + 1 < n; ++i) {
+            const T e = (uplo == Uplo::Upper) ? H(i, i + 1) : H(i + 1, i);
+            CHECK(imag(e) == zero);
+            TT(i + 1, i) = e;
+            TT(i, i + 1) = e;
+        }
+
+        // Calculate residuals
+        std::vector<T> res_;
+        auto res = new_matrix(res_, n, n);
+        std::vector<T> work_;
+        auto work = new_matrix(work_, n, n);
+
+        auto orth_res_norm = check_orthogonality(Q, res);
+        CHECK(orth_res_norm <= tol);
+
+        auto normA = lange(FROB_NORM, A);
+        auto simil_res_norm = check_similarity_transform(A, Q, TT, res, work);
+        CHECK(simil_res_norm <= tol * normA);
+
+        // Q**H * Q computed with the right-side variant of unmtr
+        lacpy(GENERAL, Q, work);
+        unmtr(RIGHT_SIDE, uplo, CONJ_TRANS, H, tau, work);
+        for (idx_t j = 0; j < n; ++j)
+            work(j, j) -= one;
+        CHECK(lange(FROB_NORM, work) <= tol);
+    }
+}
@@ -118,6 +118,7 @@ TEMPLATE_TEST_CASE("QR, RQ, QL, LQ factorization of a general m-by-n matrix",
             // Test Q is unitary
             GenHouseholderQOpts qOpts;
             qOpts.nb = nb;
+            qOpts.nc = 7;
             gen_householder_q(FORWARD, COLUMNWISE_STORAGE, Q,
                               slice(tau, range(0, min(nv, k))), qOpts);
             auto orth_Q = check_orthogonality(Q);
@@ -195,6 +196,7 @@ TEMPLATE_TEST_CASE("QR, RQ, QL, LQ factorization of a general m-by-n matrix",
             // Test Q is unitary
             GenHouseholderQOpts qOpts;
             qOpts.nb = nb;
+            qOpts.nc = 7;
             gen_householder_q(BACKWARD, COLUMNWISE_STORAGE, Q,
                               slice(tau, range(k - min(nv, k), k)), qOpts);
             auto orth_Q = check_orthogonality(Q);
@@ -244,6 +246,7 @@ TEMPLATE_TEST_CASE("QR, RQ, QL, LQ factorization of a general m-by-n matrix",
             // Test Q is unitary
             GenHouseholderQOpts qOpts;
             qOpts.nb = nb;
+            qOpts.nc = 7;
             gen_householder_q(FORWARD, ROWWISE_STORAGE, Q,
                               slice(tau, range(0, min(nv, k))), qOpts);
             auto orth_Q = check_orthogonality(Q);
@@ -321,6 +324,7 @@ TEMPLATE_TEST_CASE("QR, RQ, QL, LQ factorization of a general m-by-n matrix",
             // Test Q is unitary
             GenHouseholderQOpts qOpts;
             qOpts.nb = nb;
+            qOpts.nc = 7;
             gen_householder_q(BACKWARD, ROWWISE_STORAGE, Q,
                               slice(tau, range(k - min(nv, k), k)), qOpts);
             auto orth_Q = check_orthogonality(Q);
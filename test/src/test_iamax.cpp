@@ -0,0 +1,139 @@
+/// @file test_iamax.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the chunked search of iamax on long vectors
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/iamax.hpp>
+
+using namespace tlapack;
+
+#define TEST_TYPES_IAMAX \
+    float, double, std::complex<float>, std::complex<double>
+
+TEMPLATE_TEST_CASE("iamax finds the first maximum across chunks",
+                   "[iamax][blas]",
+                   TEST_TYPES_IAMAX)
+{
+    using T = TestType;
+    using idx_t = size_type<std::vector<T>>;
+    using real_t = real_type<T>;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Three full chunks and a partial one
+    const idx_t nb = internal::iamax_chunk;
+    const idx_t n = 3 * nb + 17;
+
+    const real_t two(2);
+    const real_t inf = std::numeric_limits<real_t>::infinity();
+    const real_t nan = std::numeric_limits<real_t>::quiet_NaN();
+
+    // Entries with abs1(x[i]) < 2
+    std::vector<T> x(n);
+    for (idx_t i = 0; i < n; ++i)
+        x[i] = rand_helper<T>(mm.gen);
+
+    // Options that ignore NaNs
+    auto absf = [](const T& a) -> real_t { return abs1(a); };
+    IamaxOpts<decltype(absf)> optsNoNaN(absf);
+    optsNoNaN.ec.nan = false;
+
+    SECTION("Maximum in a later chunk")
+    {
+        x[2 * nb + 10] = T(two);
+        CHECK(iamax(x) == 2 * nb + 10);
+        CHECK(iamax(x, optsNoNaN) == 2 * nb + 10);
+    }
+    SECTION("Ties across chunks")
+    {
+        x[nb + 5] = T(two);
+        x[2 * nb + 3] = T(two);
+        x[3 * nb + 1] = T(two);
+        CHECK(iamax(x) == nb + 5);
+        CHECK(iamax(x, optsNoNaN) == nb + 5);
+    }
+    SECTION("Ties at a chunk boundary")
+    {
+        x[nb - 1] = T(-two);
+        x[nb] = T(two);
+        CHECK(iamax(x) == nb - 1);
+        CHECK(iamax(x, optsNoNaN) == nb - 1);
+    }
+    SECTION("NaN in a later chunk")
+    {
+        x[5] = T(two);
+        x[2 * nb + 7] = T(nan);
+        CHECK(iamax(x) == 2 * nb + 7);
+        CHECK(iamax(x, optsNoNaN) == 5);
+    }
+    SECTION("Inf in a later chunk")
+    {
+        x[5] = T(two);
+        x[nb + 9] = T(-inf);
+        x[2 * nb + 7] = T(inf);
+        CHECK(iamax(x) == nb + 9);
+        CHECK(iamax(x, optsNoNaN) == nb + 9);
+    }
+    SECTION("NaN after an Inf")
+    {
+        x[nb + 9] = T(inf);
+        x[3 * nb + 2] = T(nan);
+        CHECK(iamax(x) == 3 * nb + 2);
+        CHECK(iamax(x, optsNoNaN) == nb + 9);
+    }
+}
+
+TEMPLATE_TEST_CASE("iamax compares scaled entries near overflow",
+                   "[iamax][blas]",
+                   std::complex<float>,
+                   std::complex<double>)
+{
+    using T = TestType;
+    using idx_t = size_type<std::vector<T>>;
+    using real_t = real_type<T>;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t nb = internal::iamax_chunk;
+    const idx_t n = 3 * nb + 17;
+
+    // abs1 overflows for these entries, but not their absolute values
+    const real_t big = std::numeric_limits<real_t>::max();
+    const T a(real_t(0.6) * big, real_t(0.6) * big);
+    const T b(real_t(0.7) * big, real_t(-0.7) * big);
+
+    std::vector<T> x(n);
+    for (idx_t i = 0; i < n; ++i)
+        x[i] = rand_helper<T>(mm.gen);
+
+    SECTION("Largest scaled entry in a later chunk")
+    {
+        x[nb + 3] = a;
+        x[3 * nb + 1] = b;
+        CHECK(iamax(x) == 3 * nb + 1);
+    }
+    SECTION("Ties of scaled entries across chunks")
+    {
+        x[nb + 3] = b;
+        x[2 * nb + 8] = a;
+        x[3 * nb + 1] = b;
+        CHECK(iamax(x) == nb + 3);
+    }
+    SECTION("Finite maximum before the first overflow")
+    {
+        x[7] = T(real_t(0.4) * big, real_t(0.4) * big);
+        x[2 * nb + 8] = a;
+        CHECK(iamax(x) == 2 * nb + 8);
+    }
+}
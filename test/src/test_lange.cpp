@@ -0,0 +1,93 @@
+/// @file test_lange.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the norms of general matrices computed by lange and lange_all
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lange.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("lange computes the norms of general matrices",
+                   "[norm]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Generators. The sizes cover several chunks of columns and several
+    // blocks of rows
+    const idx_t m = GENERATE(1, 7, 1100);
+    const idx_t n = GENERATE(1, 9, 5000);
+
+    // Skip very large cases
+    if (m * n > 2000000) SKIP_TEST;
+
+    // Create matrices
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    mm.random(A);
+
+    // Tolerance
+    const real_t tol = real_t(10 * (m + n)) * uroundoff<real_t>();
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n)
+    {
+        // Reference values
+        real_t maxabs(0), one(0), inf(0), fro(0);
+        std::vector<real_t> rowsum(m, real_t(0));
+        for (idx_t j = 0; j < n; ++j) {
+            real_t colsum(0);
+            for (idx_t i = 0; i < m; ++i) {
+                const real_t temp = abs(A(i, j));
+                maxabs = max(maxabs, temp);
+                colsum += temp;
+                rowsum[i] += temp;
+                fro += temp * temp;
+            }
+            one = max(one, colsum);
+        }
+        for (idx_t i = 0; i < m; ++i)
+            inf = max(inf, rowsum[i]);
+        fro = sqrt(fro);
+
+        CHECK(lange(MAX_NORM, A) == maxabs);
+        CHECK(abs(lange(ONE_NORM, A) - one) <= tol * one);
+        CHECK(abs(lange(INF_NORM, A) - inf) <= tol * inf);
+        CHECK(abs(lange(FROB_NORM, A) - fro) <= tol * fro);
+
+        const auto norms = lange_all(A);
+        CHECK(norms.max == maxabs);
+        CHECK(abs(norms.one - one) <= tol * one);
+        CHECK(abs(norms.inf - inf) <= tol * inf);
+        CHECK(abs(norms.fro - fro) <= tol * fro);
+
+        // NaNs are propagated
+        A(m / 2, n / 2) = T(std::numeric_limits<real_t>::quiet_NaN());
+        CHECK(isnan(lange(MAX_NORM, A)));
+        CHECK(isnan(lange(ONE_NORM, A)));
+        CHECK(isnan(lange(INF_NORM, A)));
+        CHECK(isnan(lange(FROB_NORM, A)));
+        const auto nanNorms = lange_all(A);
+        CHECK(isnan(nanNorms.max));
+        CHECK(isnan(nanNorms.one));
+        CHECK(isnan(nanNorms.inf));
+        CHECK(isnan(nanNorms.fro));
+    }
+}
@@ -13,11 +13,14 @@
 // Auxiliary routines
 #include <tlapack/blas/dot.hpp>
 #include <tlapack/blas/nrm2.hpp>
+#include <tlapack/lapack/lacpy.hpp>
 #include <tlapack/lapack/lange.hpp>
 
 // Other routines
 #include <tlapack/lapack/larf.hpp>
+#include <tlapack/lapack/larfb.hpp>
 #include <tlapack/lapack/larfg.hpp>
+#include <tlapack/lapack/larft.hpp>
 
 using namespace tlapack;
 
@@ -40,7 +43,7 @@ TEMPLATE_TEST_CASE("Generation of Householder reflectors",
     const Direction direction =
         GENERATE(Direction::Forward, Direction::Backward);
     const StoreV storeMode = GENERATE(StoreV::Columnwise, StoreV::Rowwise);
-    const std::string initialX = GENERATE("Zeros", "Random");
+    const std::string initialX = GENERATE("Zeros", "Random", "Tiny");
     const std::string typeAlpha = GENERATE("Real", "Complex");
     const std::string whichLARFG = GENERATE("direction,v", "alpha,x");
 
@@ -82,12 +85,18 @@ TEMPLATE_TEST_CASE("Generation of Householder reflectors",
                 v[i] = zero;
             }
         }
-        else {  // initialX == 'R'
+        else if (initialX == "Random") {
             for (idx_t i = 0; i < n; ++i) {
                 v[i] = rand_helper<T>();
             }
         }
-        v[alphaIdx] = alpha;
+        else {  // initialX == "Tiny", so that larfg needs to scale x
+            for (idx_t i = 0; i < n; ++i) {
+                v[i] = rand_helper<T>() * safe_min<real_t>();
+            }
+        }
+        v[alphaIdx] =
+            (initialX == "Tiny") ? T(alpha * safe_min<real_t>()) : alpha;
 
         // Copy v to w
         for (idx_t i = 0; i < n; ++i) {
@@ -251,3 +260,165 @@ TEMPLATE_TEST_CASE("Application of Householder reflectors",
         CHECK(lange(FROB_NORM, C) / tol < lange(FROB_NORM, C0));
     }
 }
+
+TEMPLATE_TEST_CASE("Panel-wise application of block reflectors",
+                   "[larfb]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    srand(1);
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+
+    // Test parameters
+    const idx_t m = 23;
+    const idx_t n = 17;
+    const idx_t k = 5;
+    const idx_t nc = GENERATE(1, 4, 100);
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Op trans = GENERATE(Op::NoTrans, Op::ConjTrans);
+    const Direction direction =
+        GENERATE(Direction::Forward, Direction::Backward);
+    const StoreV storeMode = GENERATE(StoreV::Columnwise, StoreV::Rowwise);
+
+    DYNAMIC_SECTION("nc = " << nc << " side = " << side << " trans = " << trans
+                            << " direction = " << direction
+                            << " storeMode = " << storeMode)
+    {
+        // Constants
+        const idx_t q = (side == Side::Left) ? m : n;
+        const real_t tol = real_t(4 * max(m, n)) * ulp<real_t>();
+
+        // Matrices
+        std::vector<T> V_;
+        auto V = (storeMode == StoreV::Columnwise) ? new_matrix(V_, q, k)
+                                                   : new_matrix(V_, k, q);
+        std::vector<T> TT_;
+        auto TT = new_matrix(TT_, k, k);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+        std::vector<T> C0_;
+        auto C0 = new_matrix(C0_, m, n);
+        std::vector<T> tau(k);
+
+        // Generate the reflectors and the triangular factor
+        for (idx_t j = 0; j < ncols(V); ++j)
+            for (idx_t i = 0; i < nrows(V); ++i)
+                V(i, j) = rand_helper<T>();
+        for (idx_t i = 0; i < k; ++i) {
+            if (storeMode == StoreV::Columnwise) {
+                auto v = (direction == Direction::Forward)
+                             ? slice(V, range{i, q}, i)
+                             : slice(V, range{0, q - k + i + 1}, i);
+                larfg(direction, storeMode, v, tau[i]);
+            }
+            else {
+                auto v = (direction == Direction::Forward)
+                             ? slice(V, i, range{i, q})
+                             : slice(V, i, range{0, q - k + i + 1});
+                larfg(direction, storeMode, v, tau[i]);
+            }
+        }
+        larft(direction, storeMode, V, tau, TT);
+
+        // Reference result without splitting C
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                C(i, j) = rand_helper<T>();
+        lacpy(GENERAL, C, C0);
+        LarfbOpts opts;
+        opts.nc = 0;
+        larfb(side, trans, direction, storeMode, V, TT, C0, opts);
+
+        opts.nc = nc;
+        larfb(side, trans, direction, storeMode, V, TT, C, opts);
+
+        // Subtract C0 from C
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                C(i, j) -= C0(i, j);
+
+        CHECK(lange(FROB_NORM, C) <= tol * lange(FROB_NORM, C0));
+    }
+}
+
+TEMPLATE_TEST_CASE("Recursive formation of the triangular factor",
+                   "[larft]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    srand(1);
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+
+    // Test parameters
+    const idx_t k = GENERATE(1, 5, 16);
+    const idx_t n = GENERATE(16, 30);
+    const Direction direction =
+        GENERATE(Direction::Forward, Direction::Backward);
+    const StoreV storeMode = GENERATE(StoreV::Columnwise, StoreV::Rowwise);
+
+    DYNAMIC_SECTION("k = " << k << " n = " << n << " direction = " << direction
+                           << " storeMode = " << storeMode)
+    {
+        // Constants
+        const real_t tol = real_t(4 * n) * ulp<real_t>();
+
+        // Matrices
+        std::vector<T> V_;
+        auto V = (storeMode == StoreV::Columnwise) ? new_matrix(V_, n, k)
+                                                   : new_matrix(V_, k, n);
+        std::vector<T> T0_;
+        auto T0 = new_matrix(T0_, k, k);
+        std::vector<T> T1_;
+        auto T1 = new_matrix(T1_, k, k);
+        std::vector<T> tau(k);
+
+        // Generate the reflectors
+        for (idx_t j = 0; j < ncols(V); ++j)
+            for (idx_t i = 0; i < nrows(V); ++i)
+                V(i, j) = rand_helper<T>();
+        for (idx_t i = 0; i < k; ++i) {
+            if (storeMode == StoreV::Columnwise) {
+                auto v = (direction == Direction::Forward)
+                             ? slice(V, range{i, n}, i)
+                             : slice(V, range{0, n - k + i + 1}, i);
+                larfg(direction, storeMode, v, tau[i]);
+            }
+            else {
+                auto v = (direction == Direction::Forward)
+                             ? slice(V, i, range{i, n})
+                             : slice(V, i, range{0, n - k + i + 1});
+                larfg(direction, storeMode, v, tau[i]);
+            }
+        }
+
+        // Zero T0 and T1 so that their unreferenced triangles match
+        for (idx_t j = 0; j < k; ++j)
+            for (idx_t i = 0; i < k; ++i)
+                T0(i, j) = T1(i, j) = T(0);
+
+        LarftOpts opts;
+        opts.variant = LarftVariant::Level2;
+        larft(direction, storeMode, V, tau, T0, opts);
+        opts.variant = LarftVariant::Recursive;
+        larft(direction, storeMode, V, tau, T1, opts);
+
+        // Subtract T0 from T1
+        for (idx_t j = 0; j < k; ++j)
+            for (idx_t i = 0; i < k; ++i)
+                T1(i, j) -= T0(i, j);
+
+        CHECK(lange(FROB_NORM, T1) <= tol * lange(FROB_NORM, T0));
+    }
+}
@@ -0,0 +1,176 @@
+/// @file test_lascl.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the auxiliary routines lacpy, laset and lascl
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lascl.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("lacpy, laset and lascl reference the entries in uplo",
+                   "[auxiliary]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(1, 5, 300);
+    const idx_t n = GENERATE(1, 7, 250);
+    const Uplo uplo = GENERATE(Uplo::General, Uplo::Upper, Uplo::Lower);
+
+    // Scalars a/b that need one and several factors in lascl
+    const int scal = GENERATE(0, 1, 2);
+    const real_t b = (scal == 0)   ? real_t(3)
+                     : (scal == 1) ? safe_min<real_t>()
+                                   : safe_max<real_t>();
+    const real_t a = (scal == 0) ? real_t(2) : real_t(1);
+
+    // Returns true if A(i,j) is in the triangle or trapezoid uplo
+    auto inUplo = [&](idx_t i, idx_t j) {
+        return (uplo == Uplo::Upper)   ? (i <= j)
+               : (uplo == Uplo::Lower) ? (j <= i)
+                                       : true;
+    };
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, m, n);
+    std::vector<T> C_;
+    auto C = new_matrix(C_, m, n);
+
+    mm.random(A);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " uplo = " << uplo
+                            << " a/b = " << a << "/" << b)
+    {
+        const T alpha = T(2);
+        const T beta = T(-3);
+
+        // laset sets the off-diagonal entries in uplo to alpha
+        mm.random(B);
+        lacpy(GENERAL, B, C);
+        laset(uplo, alpha, beta, B);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(B(i, j) == ((i == j)          ? beta
+                                  : inUplo(i, j) ? alpha
+                                                 : C(i, j)));
+
+        // lacpy copies the entries in uplo
+        lacpy(uplo, A, B);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(B(i, j) ==
+                      (inUplo(i, j) ? A(i, j) : ((i == j) ? beta : C(i, j))));
+
+        // lascl and its copying variant agree
+        lacpy(GENERAL, A, C);
+        lascl(uplo, b, a, C);
+        laset(GENERAL, T(0), T(0), B);
+        lascl(uplo, b, a, A, B);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i) {
+                if (inUplo(i, j))
+                    CHECK(B(i, j) == C(i, j));
+                else {
+                    CHECK(B(i, j) == T(0));
+                    CHECK(C(i, j) == A(i, j));
+                }
+            }
+    }
+}
+
+TEMPLATE_TEST_CASE("lascl scales by a/b when a/b overflows or underflows",
+                   "[auxiliary]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(1, 5, 30);
+    const idx_t n = GENERATE(1, 7);
+    const Uplo uplo = GENERATE(Uplo::General, Uplo::Upper, Uplo::Lower);
+
+    // The entries of A are (1 + r) sA, where r is random in [0,1), so that
+    // the entries of a/b A are not too close to the overflow and underflow
+    // thresholds. a/b is finite and normal in the first case, overflows in
+    // the second and underflows in the third. In the last two cases, 1/b is
+    // a power of two and (A a)/b is exact.
+    const int scal = GENERATE(0, 1, 2);
+    const real_t sfmin = safe_min<real_t>();
+    const real_t sfmax = safe_max<real_t>();
+    const real_t a = (scal == 0)   ? real_t(2)
+                     : (scal == 1) ? sfmax
+                                   : real_t(4) * sfmin;
+    const real_t b = (scal == 0)   ? real_t(3)
+                     : (scal == 1) ? real_t(1) / real_t(16)
+                                   : sfmax;
+    const real_t sA = (scal == 0)   ? real_t(1)
+                      : (scal == 1) ? real_t(1) / real_t(512)
+                                    : sfmax / real_t(2);
+
+    // Returns true if A(i,j) is in the triangle or trapezoid uplo
+    auto inUplo = [&](idx_t i, idx_t j) {
+        return (uplo == Uplo::Upper)   ? (i <= j)
+               : (uplo == Uplo::Lower) ? (j <= i)
+                                       : true;
+    };
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, m, n);
+
+    mm.random(A);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            A(i, j) = (real_t(1) + A(i, j)) * sA;
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " uplo = " << uplo
+                            << " scal = " << scal)
+    {
+        const real_t tol = real_t(4) * uroundoff<real_t>();
+        const real_t binv = real_t(1) / b;
+
+        lascl(uplo, b, a, A, B);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                if (inUplo(i, j)) {
+                    const T ref = (A(i, j) * a) * binv;
+                    CHECK(abs(B(i, j) - ref) <= tol * abs(ref));
+                }
+
+        lascl(uplo, b, a, A);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                if (inUplo(i, j)) CHECK(A(i, j) == B(i, j));
+    }
+}
@@ -0,0 +1,99 @@
+/// @file test_nrm2.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the unscaled sum and the lassq fallback of nrm2
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/nrm2.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("nrm2 falls back to lassq only when needed",
+                   "[norm][nrm2]",
+                   float,
+                   double,
+                   std::complex<float>,
+                   std::complex<double>)
+{
+    using T = TestType;
+    using idx_t = size_type<std::vector<T>>;
+    using real_t = real_type<T>;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // constants
+    const idx_t n = 16;
+    const real_t tol = real_t(4 * n) * uroundoff<real_t>();
+    const real_t big = std::numeric_limits<real_t>::max() / real_t(8);
+    const real_t tiny = std::numeric_limits<real_t>::min() * real_t(4);
+    const real_t inf = std::numeric_limits<real_t>::infinity();
+    const real_t nan = std::numeric_limits<real_t>::quiet_NaN();
+
+    std::vector<T> x(n);
+    for (idx_t i = 0; i < n; ++i)
+        x[i] = rand_helper<T>(mm.gen);
+
+    // Reference computed with the scaled sum of squares
+    auto ref = [&]() {
+        real_t scl(1), ssq(0);
+        lassq(x, scl, ssq);
+        return scl * sqrt(ssq);
+    };
+
+    SECTION("Entries of moderate size take the unscaled sum")
+    {
+        const real_t norm = ref();
+        CHECK(abs(nrm2(x) - norm) <= tol * norm);
+    }
+    SECTION("Entries below tsml that do not change the sum")
+    {
+        x[3] = T(tiny);
+        x[7] = T(-tiny);
+        const real_t norm = ref();
+        CHECK(abs(nrm2(x) - norm) <= tol * norm);
+    }
+    SECTION("Huge entries whose squares overflow")
+    {
+        for (idx_t i = 0; i < n; ++i)
+            x[i] = T(big);
+        const real_t norm = real_t(4) * big;
+        CHECK(abs(nrm2(x) - norm) <= tol * norm);
+    }
+    SECTION("One huge entry")
+    {
+        x[5] = T(-big);
+        CHECK(abs(nrm2(x) - big) <= tol * big);
+    }
+    SECTION("Tiny entries whose squares underflow")
+    {
+        for (idx_t i = 0; i < n; ++i)
+            x[i] = T(tiny);
+        const real_t norm = real_t(4) * tiny;
+        CHECK(abs(nrm2(x) - norm) <= tol * norm);
+    }
+    SECTION("Zero vector")
+    {
+        for (idx_t i = 0; i < n; ++i)
+            x[i] = T(0);
+        CHECK(nrm2(x) == real_t(0));
+    }
+    SECTION("NaN")
+    {
+        x[9] = T(nan);
+        CHECK(isnan(nrm2(x)));
+    }
+    SECTION("Inf")
+    {
+        x[9] = T(-inf);
+        CHECK(isinf(nrm2(x)));
+    }
+}
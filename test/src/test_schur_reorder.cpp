@@ -0,0 +1,117 @@
+/// @file test_schur_reorder.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the blocked reordering of a Schur form
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/schur_reorder.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("blocked reordering of Schur form gives correct results",
+                   "[eigenvalues]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const T zero(0);
+    const T one(1);
+
+    const idx_t n = GENERATE(1, 10, 37);
+    const idx_t nb = GENERATE(2, 4, 32);
+    const int seed = GENERATE(1, 2, 3);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = real_t(1.0e2 * n) * eps;
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> Q_;
+    auto Q = new_matrix(Q_, n, n);
+    std::vector<T> A_copy_;
+    auto A_copy = new_matrix(A_copy_, n, n);
+
+    // Generate random matrix in Schur form
+    mm.random(A);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = j + 1; i < n; ++i)
+            A(i, j) = zero;
+
+    // Put some 2x2 blocks with complex conjugate eigenvalues on the diagonal
+    if (is_real<T>)
+        for (idx_t i = (idx_t)seed; i + 1 < n; i += 5) {
+            A(i + 1, i + 1) = A(i, i);
+            A(i + 1, i) = -A(i, i + 1);
+        }
+
+    // Select eigenvalues in a pseudo-random pattern
+    std::vector<bool> select(n);
+    for (idx_t i = 0; i < n; ++i)
+        select[i] = ((i * (idx_t)seed + idx_t(7)) % 3 == 0);
+
+    // Sum of the selected eigenvalues
+    T trace_selected = zero;
+    for (idx_t i = 0; i < n; ++i) {
+        idx_t bs = 1;
+        if (is_real<T> && i + 1 < n && A(i + 1, i) != zero) bs = 2;
+        if (select[i] || (bs == 2 && select[i + 1]))
+            for (idx_t k = i; k < i + bs; ++k)
+                trace_selected += A(k, k);
+        i += bs - 1;
+    }
+
+    lacpy(GENERAL, A, A_copy);
+    laset(GENERAL, zero, one, Q);
+
+    DYNAMIC_SECTION("n = " << n << " nb = " << nb << " seed = " << seed)
+    {
+        SchurReorderOpts opts;
+        opts.nb = nb;
+        opts.nw = 2 * nb;
+
+        idx_t m;
+        int ierr = schur_reorder(true, A, Q, select, m, opts);
+        CHECK(ierr == 0);
+
+        // Calculate residuals
+        std::vector<T> res_;
+        auto res = new_matrix(res_, n, n);
+        std::vector<T> work_;
+        auto work = new_matrix(work_, n, n);
+        auto orth_res_norm = check_orthogonality(Q, res);
+        CHECK(orth_res_norm <= tol);
+
+        auto normA = tlapack::lange(tlapack::FROB_NORM, A);
+        auto simil_res_norm =
+            check_similarity_transform(A_copy, Q, A, res, work);
+        CHECK(simil_res_norm <= tol * normA);
+
+        // The selected eigenvalues must be in the leading m-by-m block
+        if (m > 0 && m < n) CHECK(A(m, m - 1) == zero);
+        T trace_leading = zero;
+        for (idx_t i = 0; i < m; ++i)
+            trace_leading += A(i, i);
+        CHECK(abs1(trace_leading - trace_selected) <= tol * normA);
+    }
+}
@@ -0,0 +1,123 @@
+/// @file test_stedc.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the divide and conquer method for tridiagonal eigenproblems
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/stedc.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Divide and conquer computes the tridiagonal eigensystem",
+                   "[eigenvalues][tridiagonal]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const std::string matrix_type =
+        GENERATE("Random", "Wilkinson", "Split", "Constant");
+    const idx_t n = GENERATE(1, 2, 9, 40, 101);
+    const idx_t smlsiz = GENERATE(1, 2, 5, 25);
+
+    const real_t zero(0);
+    const real_t one(1);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = real_t(n * 1.0e2) * eps;
+
+    // Define the matrices and vectors
+    std::vector<T> TT_;
+    auto TT = new_matrix(TT_, n, n);
+    std::vector<T> Z_;
+    auto Z = new_matrix(Z_, n, n);
+    std::vector<real_t> d(n);
+    std::vector<real_t> e(max<idx_t>(1, n - 1));
+
+    // Generate the tridiagonal matrix
+    if (matrix_type == "Random") {
+        for (idx_t i = 0; i < n; ++i)
+            d[i] = rand_helper<real_t>(mm.gen);
+        for (idx_t i = 0; i + 1 < n; ++i)
+            e[i] = rand_helper<real_t>(mm.gen);
+    }
+    else if (matrix_type == "Wilkinson") {
+        // Eigenvalues come in close pairs
+        for (idx_t i = 0; i < n; ++i)
+            d[i] = abs(real_t(n / 2) - real_t(i));
+        for (idx_t i = 0; i + 1 < n; ++i)
+            e[i] = one;
+    }
+    else if (matrix_type == "Split") {
+        for (idx_t i = 0; i < n; ++i)
+            d[i] = rand_helper<real_t>(mm.gen);
+        for (idx_t i = 0; i + 1 < n; ++i)
+            e[i] = (i % 7 == 3) ? zero : rand_helper<real_t>(mm.gen);
+    }
+    else {
+        // Multiple eigenvalue 1, so that most of the merges deflate
+        for (idx_t i = 0; i < n; ++i)
+            d[i] = one;
+        for (idx_t i = 0; i + 1 < n; ++i)
+            e[i] = (i % 2 == 0) ? zero : one;
+    }
+
+    laset(GENERAL, zero, zero, TT);
+    for (idx_t i = 0; i < n; ++i)
+        TT(i, i) = d[i];
+    for (idx_t i = 0; i + 1 < n; ++i) {
+        TT(i + 1, i) = e[i];
+        TT(i, i + 1) = e[i];
+    }
+
+    DYNAMIC_SECTION("matrix = " << matrix_type << " n = " << n
+                                << " smlsiz = " << smlsiz)
+    {
+        laset(GENERAL, zero, one, Z);
+
+        StedcOpts opts;
+        opts.smlsiz = smlsiz;
+        int info = stedc(d, e, Z, opts);
+        REQUIRE(info == 0);
+
+        // The eigenvalues are in ascending order
+        for (idx_t i = 0; i + 1 < n; ++i)
+            CHECK(d[i] <= d[i + 1]);
+
+        // Calculate residuals
+        std::vector<T> res_;
+        auto res = new_matrix(res_, n, n);
+
+        auto orth_res_norm = check_orthogonality(Z, res);
+        CHECK(orth_res_norm <= tol);
+
+        // res = T * Z - Z * diag(d)
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                res(i, j) = Z(i, j) * d[j];
+        gemm(NO_TRANS, NO_TRANS, one, TT, Z, -one, res);
+        const real_t normT = max(one, lange(FROB_NORM, TT));
+        CHECK(lange(FROB_NORM, res) <= tol * normT);
+    }
+}
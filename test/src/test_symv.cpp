@@ -0,0 +1,86 @@
+/// @file test_symv.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the symmetric and Hermitian matrix-vector products
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/hemv.hpp>
+#include <tlapack/blas/symv.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("symv and hemv agree with the naive product",
+                   "[symv][hemv][blas]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Uplo uplo = GENERATE(Uplo::Upper, Uplo::Lower);
+    const bool herm = GENERATE(false, true);
+    // n = 400 is above 2 * internal::matvec_parallel_min entries
+    const idx_t n = GENERATE(1, 5, 70, 400);
+
+    const T alpha = T(0.5f);
+    const T beta = T(-0.25f);
+
+    // Only the triangle uplo of A is referenced. The other triangle, and the
+    // imaginary part of the diagonal in the Hermitian case, are random.
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> x(n), y(n), yref(n);
+    std::vector<real_t> ybound(n);
+    mm.random(A);
+    for (idx_t j = 0; j < n; ++j)
+        x[j] = rand_helper<T>(mm.gen);
+    for (idx_t i = 0; i < n; ++i)
+        y[i] = rand_helper<T>(mm.gen);
+
+    // Entry (i,j) of the symmetric or Hermitian matrix
+    auto fullA = [&](idx_t i, idx_t j) -> T {
+        if (i == j) return herm ? T(real(A(i, i))) : A(i, i);
+        const bool inTriangle = (uplo == Uplo::Upper) ? (i < j) : (i > j);
+        if (inTriangle) return A(i, j);
+        return herm ? conj(A(j, i)) : A(j, i);
+    };
+
+    // Naive product and bound for the sum of the absolute values of the terms
+    for (idx_t i = 0; i < n; ++i) {
+        T sum(0);
+        real_t sumabs(0);
+        for (idx_t j = 0; j < n; ++j) {
+            sum += fullA(i, j) * x[j];
+            sumabs += abs(fullA(i, j)) * abs(x[j]);
+        }
+        yref[i] = alpha * sum + beta * y[i];
+        ybound[i] = abs(alpha) * sumabs + abs(beta) * abs(y[i]);
+    }
+
+    DYNAMIC_SECTION("uplo = " << uplo << " herm = " << herm << " n = " << n)
+    {
+        if (herm)
+            hemv(uplo, alpha, A, x, beta, y);
+        else
+            symv(uplo, alpha, A, x, beta, y);
+
+        const real_t tol = real_t(2 * (n + 2)) * ulp<real_t>();
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs(y[i] - yref[i]) <= tol * ybound[i]);
+    }
+}
@@ -12,6 +12,7 @@
 #include "testutils.hpp"
 
 // <T>LAPACK
+#include <tlapack/lapack/lacpy.hpp>
 #include <tlapack/lapack/transpose.hpp>
 
 using namespace tlapack;
@@ -99,3 +100,77 @@ TEMPLATE_TEST_CASE("Transpose gives correct result",
                 CHECK(B(j, i) == A(i, j));
     }
 }
+
+TEMPLATE_TEST_CASE("In place transpose gives correct result",
+                   "[util]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Generate n
+    idx_t n = GENERATE(1, 2, 3, 5, 10, 17, 40);
+    // Generate m
+    idx_t m = GENERATE(1, 2, 3, 5, 10, 17, 40);
+
+    // Define the matrices
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, n);
+
+    // Generate a random matrix in A
+    mm.random(A);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n)
+    {
+        TransposeOpts opts;
+        // Set nx to a small value so that the recursion gets tested even for
+        // small n
+        opts.nx = 3;
+
+        if (m == n) {
+            lacpy(GENERAL, A, B);
+            transpose_inplace(B, opts);
+            for (idx_t i = 0; i < n; ++i)
+                for (idx_t j = 0; j < n; ++j)
+                    CHECK(B(j, i) == A(i, j));
+
+            lacpy(GENERAL, A, B);
+            conjtranspose_inplace(B, opts);
+            for (idx_t i = 0; i < n; ++i)
+                for (idx_t j = 0; j < n; ++j)
+                    CHECK(B(j, i) == conj(A(i, j)));
+        }
+
+        // Out of place with the default block size, which uses the 4-by-4
+        // kernel
+        std::vector<T> C_;
+        auto C = new_matrix(C_, n, m);
+        transpose(A, C);
+        for (idx_t i = 0; i < m; ++i)
+            for (idx_t j = 0; j < n; ++j)
+                CHECK(C(j, i) == A(i, j));
+
+        // Contiguous storage, column by column
+        std::vector<T> x(m * n);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                x[i + j * m] = A(i, j);
+        transpose_inplace(m, n, x);
+        for (idx_t i = 0; i < m; ++i)
+            for (idx_t j = 0; j < n; ++j)
+                CHECK(x[j + i * n] == A(i, j));
+        conjtranspose_inplace(n, m, x);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(x[i + j * m] == conj(A(i, j)));
+    }
+}
@@ -0,0 +1,136 @@
+/// @file test_trevc3.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the computation of eigenvectors from the Schur form
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/qr_iteration.hpp>
+#include <tlapack/lapack/trevc3.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("eigenvectors from the Schur form are correct",
+                   "[eigenvalues][eigenvectors]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = complex_type<real_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 2, 10, 37);
+    const idx_t nb = GENERATE(2, 5, 32);
+    const bool backtransform = GENERATE(true, false);
+    const int seed = GENERATE(2, 3);
+
+    const real_t zero(0);
+    const real_t one(1);
+
+    // Random number generator
+    mm.gen.seed(seed);
+
+    // Define the matrices
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> H_;
+    auto H = new_matrix(H_, n, n);
+    std::vector<T> Q_;
+    auto Q = new_matrix(Q_, n, n);
+    std::vector<T> V_;
+    auto V = new_matrix(V_, n, n);
+    std::vector<T> R_;
+    auto R = new_matrix(R_, n, n);
+
+    // Schur form of a random Hessenberg matrix
+    mm.hessenberg(A);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = j + 2; i < n; ++i)
+            A(i, j) = zero;
+    lacpy(GENERAL, A, H);
+    std::vector<complex_t> s(n);
+    laset(GENERAL, zero, one, Q);
+    QRIterationOpts qr_opts;
+    int ierr = qr_iteration(true, true, 0, n, H, s, Q, qr_opts);
+    REQUIRE(ierr == 0);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = j + 2; i < n; ++i)
+            H(i, j) = zero;
+
+    DYNAMIC_SECTION("n = " << n << " nb = " << nb << " backtransform = "
+                           << backtransform << " seed = " << seed)
+    {
+        Trevc3Opts opts;
+        opts.nb = nb;
+
+        if (backtransform) lacpy(GENERAL, Q, V);
+        ierr = trevc3(backtransform, H, V, opts);
+        CHECK(ierr == 0);
+
+        // R = M V - V Lambda, where M is either A or H
+        if (backtransform)
+            gemm(NO_TRANS, NO_TRANS, one, A, V, R);
+        else
+            gemm(NO_TRANS, NO_TRANS, one, H, V, R);
+        for (idx_t j = 0; j < n;) {
+            if (is_real<T> && j + 1 < n && H(j + 1, j) != zero) {
+                const T wr = H(j, j);
+                const T wi = T(sqrt(abs(H(j, j + 1))) * sqrt(abs(H(j + 1, j))));
+                for (idx_t i = 0; i < n; ++i) {
+                    const T vr = V(i, j);
+                    const T vi = V(i, j + 1);
+                    R(i, j) -= wr * vr - wi * vi;
+                    R(i, j + 1) -= wi * vr + wr * vi;
+                }
+                j += 2;
+            }
+            else {
+                const T w = H(j, j);
+                for (idx_t i = 0; i < n; ++i)
+                    R(i, j) -= w * V(i, j);
+                j += 1;
+            }
+        }
+
+        const real_t eps = uroundoff<real_t>();
+        const real_t tol = real_t(n * 1.0e2) * eps;
+
+        const real_t normA = lange(FROB_NORM, A);
+        const real_t normV = lange(FROB_NORM, V);
+        CHECK(lange(FROB_NORM, R) <= tol * normA * normV);
+
+        // Each eigenvector is normalized
+        for (idx_t j = 0; j < n;) {
+            const idx_t bs =
+                (is_real<T> && j + 1 < n && H(j + 1, j) != zero) ? 2 : 1;
+            real_t emax(0);
+            for (idx_t i = 0; i < n; ++i) {
+                real_t vi = abs1(V(i, j));
+                if (bs == 2) vi += abs1(V(i, j + 1));
+                emax = max(emax, vi);
+            }
+            CHECK(abs(emax - one) <= tol);
+            j += bs;
+        }
+    }
+}
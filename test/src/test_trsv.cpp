@@ -0,0 +1,83 @@
+/// @file test_trsv.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the blocked triangular solve and matrix-vector product
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/trmv.hpp>
+#include <tlapack/blas/trsv.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("blocked trsv and trmv agree with the unblocked kernels",
+                   "[trsv][trmv][blas]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Uplo uplo = GENERATE(Uplo::Upper, Uplo::Lower);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans, Op::Conj);
+    const Diag diag = GENERATE(Diag::NonUnit, Diag::Unit);
+
+    // More than three blocks of order internal::triangular_matvec_block
+    const idx_t n = 200;
+
+    // Well-conditioned triangular matrix: the off-diagonal entries are small
+    // compared to the diagonal, which is 1 or has absolute value in [1,2)
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    mm.random(A);
+    for (idx_t j = 0; j < n; ++j) {
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) /= real_t(n);
+        A(j, j) += real_t(1);
+    }
+
+    std::vector<T> x(n), xref(n);
+    for (idx_t i = 0; i < n; ++i)
+        xref[i] = x[i] = rand_helper<T>(mm.gen);
+
+    // Componentwise distance relative to the largest entry of xref. Both
+    // kernels differ only in the order of the sums, and A is well
+    // conditioned, so that a few ulps suffice
+    auto check = [&]() {
+        real_t xmax(0);
+        for (idx_t i = 0; i < n; ++i)
+            xmax = max(xmax, abs(xref[i]));
+        const real_t tol = real_t(8) * ulp<real_t>() * xmax;
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs(x[i] - xref[i]) <= tol);
+    };
+
+    DYNAMIC_SECTION("trsv uplo = " << uplo << " trans = " << trans
+                                   << " diag = " << diag)
+    {
+        internal::trsv_unblocked(uplo, trans, diag, A, xref);
+        trsv(uplo, trans, diag, A, x);
+        check();
+    }
+    DYNAMIC_SECTION("trmv uplo = " << uplo << " trans = " << trans
+                                   << " diag = " << diag)
+    {
+        internal::trmv_unblocked(uplo, trans, diag, A, xref);
+        trmv(uplo, trans, diag, A, x);
+        check();
+    }
+}
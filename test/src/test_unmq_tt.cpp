@@ -0,0 +1,110 @@
+/// @file test_unmq_tt.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test unmq_tt with precomputed block reflectors
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/gelq2.hpp>
+#include <tlapack/lapack/geql2.hpp>
+#include <tlapack/lapack/geqr2.hpp>
+#include <tlapack/lapack/gerq2.hpp>
+#include <tlapack/lapack/unmq.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Multiply with precomputed block reflectors",
+                   "[unmqr][unmq_tt]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = 12;
+    const idx_t k = GENERATE(1, 7, 12);
+    const idx_t nb = GENERATE(1, 3, 5);
+    const idx_t nc = GENERATE(0, 2, 5);
+
+    const Direction direction =
+        GENERATE(Direction::Forward, Direction::Backward);
+    const StoreV storeMode = GENERATE(StoreV::Columnwise, StoreV::Rowwise);
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Op trans = GENERATE(Op::NoTrans, Op::ConjTrans);
+
+    const idx_t mc = (side == Side::Left) ? m : 9;
+    const idx_t ncC = (side == Side::Left) ? 9 : m;
+
+    const real_t eps = ulp<real_t>();
+    const real_t tol = real_t(100.0 * m) * eps;
+
+    // Reflectors from a QR, LQ, QL or RQ factorization
+    std::vector<T> V_;
+    auto V = (storeMode == StoreV::Columnwise) ? new_matrix(V_, m, k)
+                                               : new_matrix(V_, k, m);
+    std::vector<T> tau(k);
+    mm.random(V);
+    if (direction == Direction::Forward) {
+        if (storeMode == StoreV::Columnwise)
+            geqr2(V, tau);
+        else
+            gelq2(V, tau);
+    }
+    else {
+        if (storeMode == StoreV::Columnwise)
+            geql2(V, tau);
+        else
+            gerq2(V, tau);
+    }
+
+    std::vector<T> TT_;
+    auto TT = new_matrix(TT_, k, nb);
+
+    DYNAMIC_SECTION("k = " << k << " nb = " << nb << " nc = " << nc
+                           << " direction = " << direction
+                           << " storeMode = " << storeMode
+                           << " side = " << side << " trans = " << trans)
+    {
+        UnmqOpts opts;
+        opts.nb = nb;
+        opts.nc = nc;
+
+        unmq_form_tt(direction, storeMode, V, tau, TT);
+
+        // The same factors are used for two right-hand sides
+        for (int batch = 0; batch < 2; ++batch) {
+            std::vector<T> C_;
+            auto C = new_matrix(C_, mc, ncC);
+            std::vector<T> Cq_;
+            auto Cq = new_matrix(Cq_, mc, ncC);
+            mm.random(C);
+            lacpy(GENERAL, C, Cq);
+
+            unmq(side, trans, direction, storeMode, V, tau, Cq, opts);
+            unmq_tt(side, trans, direction, storeMode, V, TT, C, opts);
+
+            for (idx_t j = 0; j < ncC; ++j)
+                for (idx_t i = 0; i < mc; ++i)
+                    C(i, j) -= Cq(i, j);
+            CHECK(lange(MAX_NORM, C) <= tol);
+        }
+    }
+}
@@ -11,6 +11,10 @@
 // Test utilities and definitions (must come before <T>LAPACK headers)
 #include "testutils.hpp"
 
+// Other routines
+#include <tlapack/lapack/hasinf.hpp>
+#include <tlapack/lapack/hasnan.hpp>
+
 using namespace tlapack;
 
 TEST_CASE("Random generator is consistent if seed is fixed", "[utils]")
@@ -51,3 +55,86 @@ TEST_CASE("is_matrix and is_vector work", "[utils]")
     CHECK(!is_vector<float>);
     CHECK(!is_vector<std::complex<double> >);
 }
+
+TEMPLATE_TEST_CASE("hasnan and hasinf only check the accessed entries",
+                   "[utils]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t m = GENERATE(1, 7, 70);
+    const idx_t n = GENERATE(1, 9, 130);
+    const Uplo uplo =
+        GENERATE(Uplo::General, Uplo::UpperHessenberg, Uplo::LowerHessenberg,
+                 Uplo::Upper, Uplo::Lower, Uplo::StrictUpper,
+                 Uplo::StrictLower);
+
+    const real_t nan = std::numeric_limits<real_t>::quiet_NaN();
+    const real_t inf = std::numeric_limits<real_t>::infinity();
+
+    // Returns true if A(i,j) is accessed for the given uplo
+    auto accessed = [&](idx_t i, idx_t j) {
+        if (uplo == Uplo::UpperHessenberg) return i <= j + 1;
+        if (uplo == Uplo::LowerHessenberg) return j <= i + 1;
+        if (uplo == Uplo::Upper) return i <= j;
+        if (uplo == Uplo::Lower) return j <= i;
+        if (uplo == Uplo::StrictUpper) return i < j;
+        if (uplo == Uplo::StrictLower) return j < i;
+        return true;
+    };
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " uplo = " << uplo)
+    {
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                A(i, j) = T(1);
+        CHECK(!hasnan(uplo, A));
+        CHECK(!hasinf(uplo, A));
+
+        // Try a few positions, including the corners and the diagonals
+        const idx_t pos[][2] = {{0, 0},         {m - 1, n - 1}, {m - 1, 0},
+                                {0, n - 1},     {m / 2, n / 2}, {1, 0},
+                                {0, 1},         {m / 2, n - 1}, {m - 1, n / 3}};
+        for (const auto& p : pos) {
+            const idx_t i = p[0];
+            const idx_t j = p[1];
+            if (i >= m || j >= n) continue;
+
+            A(i, j) = T(nan);
+            CHECK(hasnan(uplo, A) == accessed(i, j));
+            CHECK(!hasinf(uplo, A));
+
+            A(i, j) = T(-inf);
+            CHECK(!hasnan(uplo, A));
+            CHECK(hasinf(uplo, A) == accessed(i, j));
+
+            A(i, j) = T(1);
+        }
+
+        // Band access and vectors
+        const idx_t kl = min<idx_t>(2, m - 1);
+        const idx_t ku = min<idx_t>(3, n - 1);
+        const idx_t i = m - 1;
+        const idx_t j = n / 2;
+        A(i, j) = T(nan);
+        CHECK(hasnan(BandAccess{kl, ku}, A) ==
+              (i <= j + kl && j <= i + ku));
+        CHECK(hasnan(slice(A, range{0, m}, j)));
+        CHECK(!hasnan(slice(A, range{0, i}, j)));
+        A(i, j) = T(inf);
+        CHECK(hasinf(BandAccess{kl, ku}, A) ==
+              (i <= j + kl && j <= i + ku));
+        CHECK(hasinf(slice(A, i, range{0, n})));
+        CHECK(!hasinf(slice(A, i, range{0, j})));
+    }
+}